@@ -1,4 +1,6 @@
 /* This file is automatically generated by gen-sprites.py */
+#define MIP_LEVELS 4
+
 #define PLAYER_TILE_W 57
 #define PLAYER_TILE_H 59
 
@@ -1920,6 +1922,2861 @@ static const u8 g_player_spritesheet[PLAYER_NTILES * PLAYER_TILE_W * PLAYER_TILE
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x17, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
   };
 
+static const u8 g_player_spritesheet_mip1[PLAYER_NTILES * 29 * 30] = {
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x68, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x5B, 0x60, 0x4D, 0x40, 0x5B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 
+  0x40, 0x2A, 0x39, 0x30, 0x3A, 0x49, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x57, 0x3A, 0x40, 0x39, 0x4E, 
+  0x42, 0x40, 0x49, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2C, 0x49, 0x49, 0x65, 0x53, 0x49, 0x60, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x24, 0x2D, 0x1C, 0x1B, 0x25, 0x32, 0x2C, 0x1D, 0x27, 0x34, 0x24, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x24, 0x34, 0x3C, 0x34, 0x20, 0x1D, 0x12, 0x14, 0x18, 0x27, 0x34, 0x2D, 0x20, 0x00, 0x00, 0x00, 
+  0x00, 0x1E, 0x1B, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x27, 0x2D, 0x2D, 
+  0x34, 0x34, 0x2D, 0x1C, 0x20, 0x27, 0x27, 0x1C, 0x1C, 0x1C, 0x00, 0x39, 0x33, 0x1B, 0x0C, 0x01, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2E, 0x48, 0x56, 0x1F, 0x18, 0x24, 0x24, 
+  0x20, 0x20, 0x1C, 0x11, 0x0C, 0x0F, 0x2A, 0x33, 0x26, 0x1E, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x81, 0x78, 0x5D, 0x0B, 0x15, 0x11, 0x0D, 0x13, 0x17, 
+  0x1F, 0x28, 0x1E, 0x1F, 0x26, 0x31, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x4C, 0x68, 0x65, 0x35, 0x11, 0x11, 0x0F, 0x1D, 0x28, 0x26, 0x17, 0x17, 0x17, 
+  0x3F, 0x38, 0x5D, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x3B, 0x76, 0x03, 0x74, 0x28, 0x1E, 0x22, 0x22, 0x17, 0x12, 0x17, 0x17, 0x1F, 0x35, 0x2E, 0x2E, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x6B, 0x6C, 
+  0x45, 0x1E, 0x14, 0x14, 0x12, 0x14, 0x14, 0x0F, 0x1D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x23, 0x17, 0x12, 0x0C, 0x0C, 
+  0x17, 0x17, 0x21, 0x16, 0x0F, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x0C, 0x0F, 0x38, 0x3F, 0x2E, 0x19, 
+  0x1D, 0x19, 0x1D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x15, 0x1D, 0x19, 0x0D, 0x15, 0x18, 0x15, 0x11, 
+  0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x18, 0x0D, 0x0D, 0x11, 0x18, 0x15, 0x15, 0x11, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x0D, 0x11, 0x11, 0x0D, 0x11, 0x11, 0x1C, 0x1C, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0x11, 
+  0x11, 0x0D, 0x15, 0x18, 0x18, 0x18, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0x11, 0x0D, 0x11, 
+  0x1C, 0x2C, 0x18, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x0D, 0x0D, 0x1F, 0x3A, 0x40, 0x32, 
+  0x2C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x19, 0x1F, 0x1F, 0x1F, 0x1D, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x1D, 0x32, 0x32, 0x2C, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x13, 0x19, 0x32, 0x2C, 0x32, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 
+  0x13, 0x2C, 0x3A, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x13, 0x2C, 0x40, 
+  0x2C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x57, 0x60, 0x40, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2A, 0x3A, 0x4D, 0x2C, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x16, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x68, 
+  0x65, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5B, 0x49, 0x57, 0x5B, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3A, 0x30, 0x39, 0x2A, 0x2A, 0x53, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x53, 0x40, 0x3E, 0x4E, 0x46, 0x30, 0x40, 0x5B, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x60, 0x5B, 0x68, 0x57, 0x57, 0x65, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0x2C, 
+  0x2C, 0x25, 0x1A, 0x1F, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2D, 0x37, 0x37, 0x18, 0x17, 0x14, 0x12, 0x14, 
+  0x20, 0x37, 0x34, 0x24, 0x00, 0x17, 0x17, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x20, 0x34, 0x2D, 0x2D, 0x37, 0x34, 0x1C, 0x18, 0x27, 0x18, 0x18, 0x24, 
+  0x40, 0x33, 0x12, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x3D, 0x48, 0x2C, 0x1C, 0x27, 0x27, 0x20, 0x15, 0x15, 0x1F, 0x14, 0x30, 0x30, 0x1B, 0x2B, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0x7A, 
+  0x55, 0x0E, 0x11, 0x11, 0x1D, 0x1F, 0x28, 0x22, 0x14, 0x12, 0x0F, 0x5D, 0x63, 0x4C, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x47, 0x72, 0x6B, 0x29, 0x0D, 0x0D, 
+  0x25, 0x32, 0x22, 0x14, 0x14, 0x12, 0x14, 0x29, 0x2E, 0x23, 0x1A, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3A, 0x56, 0x65, 0x3B, 0x17, 0x26, 0x22, 0x14, 0x14, 
+  0x14, 0x12, 0x0D, 0x1D, 0x1A, 0x23, 0x29, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x1D, 0x5D, 0x57, 0x22, 0x12, 0x14, 0x14, 0x14, 0x19, 0x12, 0x0F, 0x41, 
+  0x23, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x1B, 0x14, 0x0F, 0x0F, 0x14, 0x17, 0x14, 0x29, 0x21, 0x19, 0x2F, 0x2F, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 
+  0x0F, 0x0F, 0x1A, 0x2F, 0x36, 0x14, 0x1D, 0x25, 0x18, 0x15, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x0F, 0x1D, 
+  0x1F, 0x1F, 0x19, 0x11, 0x18, 0x15, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0x18, 0x1C, 0x20, 0x0D, 
+  0x11, 0x11, 0x11, 0x0D, 0x11, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0x11, 0x18, 0x11, 0x11, 0x0D, 0x11, 0x0D, 
+  0x0D, 0x0D, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x0D, 0x11, 0x11, 0x11, 0x0D, 0x0D, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x0D, 0x11, 0x15, 0x11, 0x0D, 0x11, 0x15, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x0D, 0x11, 0x11, 0x0D, 0x1F, 0x1D, 0x2C, 0x25, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x1F, 0x1F, 
+  0x19, 0x0E, 0x19, 0x25, 0x1F, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1D, 0x19, 0x0E, 0x0E, 0x1D, 
+  0x19, 0x1D, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x19, 0x19, 0x19, 0x1D, 0x19, 0x13, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x19, 0x13, 0x19, 0x1F, 0x1D, 0x13, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x1F, 0x19, 0x13, 0x00, 0x32, 0x2C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x1D, 0x19, 0x0E, 0x25, 0x49, 0x5B, 0x2C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 
+  0x2C, 0x32, 0x3A, 0x2C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x12, 0x13, 
+  0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x68, 0x65, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x60, 0x57, 0x5B, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3A, 0x30, 0x42, 
+  0x30, 0x22, 0x53, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4D, 0x49, 0x33, 0x46, 0x30, 0x33, 0x40, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x36, 0x4A, 0x45, 0x68, 0x53, 0x53, 0x5B, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x34, 0x34, 0x24, 0x17, 0x1F, 0x2C, 0x25, 0x1A, 0x34, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x27, 0x2D, 0x37, 
+  0x2D, 0x1C, 0x19, 0x0E, 0x13, 0x18, 0x34, 0x3C, 0x34, 0x20, 0x00, 0x00, 0x1B, 0x14, 0x17, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x1C, 0x20, 0x1C, 0x2D, 0x2D, 0x2D, 
+  0x18, 0x24, 0x20, 0x27, 0x27, 0x24, 0x32, 0x1E, 0x14, 0x0F, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x48, 0x48, 0x0D, 0x1C, 0x20, 0x20, 0x15, 0x15, 0x15, 
+  0x0F, 0x2A, 0x30, 0x28, 0x14, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x47, 0x5D, 0x2E, 0x16, 0x0B, 0x0D, 0x15, 0x2C, 0x28, 0x2A, 0x12, 0x17, 0x17, 
+  0x2B, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x40, 0x5F, 0x48, 0x0C, 0x17, 0x28, 0x28, 0x1B, 0x14, 0x17, 0x17, 0x19, 0x21, 0x4C, 0x2E, 0x2E, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x51, 0x56, 0x45, 
+  0x1E, 0x1E, 0x14, 0x14, 0x17, 0x17, 0x12, 0x11, 0x1C, 0x1A, 0x23, 0x29, 0x38, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x1E, 0x17, 0x14, 0x12, 0x17, 0x17, 
+  0x17, 0x17, 0x0F, 0x0B, 0x40, 0x2C, 0x00, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x12, 0x12, 0x12, 0x1D, 0x14, 0x19, 0x23, 0x0F, 
+  0x13, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x12, 0x12, 0x12, 0x2B, 0x38, 0x0F, 0x1D, 0x1F, 0x0F, 0x15, 0x15, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x0F, 0x18, 0x1C, 0x25, 0x15, 0x11, 0x14, 0x11, 0x15, 0x11, 0x11, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x15, 0x18, 0x18, 0x18, 0x11, 0x0F, 0x15, 0x11, 0x0D, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x11, 0x11, 
+  0x11, 0x11, 0x0B, 0x0B, 0x0D, 0x0D, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x0D, 
+  0x0D, 0x0D, 0x0D, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x2C, 0x32, 0x25, 0x0D, 0x0D, 0x0D, 0x11, 
+  0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x32, 0x32, 0x1F, 0x12, 0x0D, 0x0D, 0x13, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x19, 0x1D, 0x1D, 0x1F, 0x19, 0x13, 0x1D, 0x1D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 
+  0x1F, 0x25, 0x1F, 0x1D, 0x19, 0x1D, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1D, 0x25, 0x32, 0x1F, 
+  0x13, 0x1F, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0x32, 0x25, 0x13, 0x13, 0x1D, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0x49, 0x2C, 0x19, 0x1D, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x32, 0x57, 0x32, 0x1B, 0x26, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x32, 0x57, 0x3A, 0x2C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0x1F, 
+  0x1D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x65, 0x60, 0x5B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x65, 0x40, 0x49, 0x49, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 
+  0x40, 0x39, 0x54, 0x39, 0x1E, 0x57, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0x6C, 0x42, 0x57, 
+  0x39, 0x57, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x3C, 0x34, 0x32, 0x45, 0x45, 0x57, 0x4D, 0x3B, 0x40, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x20, 0x37, 0x43, 0x43, 0x27, 0x1D, 0x17, 0x17, 0x14, 0x12, 0x37, 0x3C, 0x34, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 
+  0x27, 0x27, 0x2D, 0x3C, 0x2D, 0x18, 0x0B, 0x15, 0x20, 0x27, 0x34, 0x27, 0x1C, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x48, 0x18, 0x18, 
+  0x27, 0x27, 0x27, 0x18, 0x27, 0x27, 0x27, 0x18, 0x1C, 0x1C, 0x00, 0x00, 0x00, 0x17, 0x17, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x47, 0x72, 0x7C, 0x72, 0x0B, 0x18, 0x18, 0x15, 
+  0x1C, 0x18, 0x15, 0x11, 0x19, 0x67, 0x48, 0x28, 0x1B, 0x0C, 0x0A, 0x01, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x3B, 0x68, 0x65, 0x3D, 0x0D, 0x11, 0x15, 0x15, 0x11, 0x13, 0x1D, 
+  0x14, 0x12, 0x22, 0x2A, 0x1B, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x3A, 0x65, 0x7C, 0x48, 0x0D, 0x0B, 0x0D, 0x1F, 0x25, 0x1E, 0x1B, 0x14, 0x0F, 0x0F, 
+  0x0F, 0x35, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1D, 
+  0x5D, 0x7C, 0x4A, 0x1D, 0x14, 0x22, 0x17, 0x12, 0x0F, 0x12, 0x14, 0x0F, 0x12, 0x35, 0x2B, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2A, 0x1E, 0x17, 
+  0x14, 0x0F, 0x12, 0x12, 0x12, 0x14, 0x12, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x0F, 0x0F, 0x0F, 0x12, 0x12, 
+  0x12, 0x15, 0x15, 0x11, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x19, 0x18, 0x38, 0x38, 0x0F, 0x15, 0x1C, 
+  0x15, 0x1C, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x18, 0x20, 0x24, 0x1F, 0x11, 0x18, 0x24, 0x18, 0x15, 0x0D, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x11, 0x11, 0x18, 0x1C, 0x18, 0x11, 0x11, 0x11, 0x15, 0x15, 0x0D, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x11, 0x15, 0x15, 0x18, 0x15, 0x18, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 
+  0x15, 0x15, 0x11, 0x11, 0x11, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x1F, 0x1F, 0x1D, 0x1F, 0x15, 
+  0x15, 0x11, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1D, 0x25, 0x1F, 0x1F, 0x1D, 0x1F, 0x25, 0x25, 0x17, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x13, 0x1D, 0x1D, 0x19, 0x19, 0x19, 0x1F, 0x1F, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x1D, 0x2C, 0x1F, 0x1D, 0x17, 0x19, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 
+  0x1F, 0x13, 0x19, 0x13, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x2C, 0x1D, 0x19, 
+  0x13, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0x5B, 0x2C, 0x13, 0x13, 0x13, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x40, 0x2C, 0x00, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x25, 0x1D, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x65, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x5B, 
+  0x6C, 0x6C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x36, 0x30, 0x39, 0x2A, 0x57, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x45, 0x3B, 0x39, 0x42, 0x33, 0x57, 0x49, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x4A, 0x57, 0x68, 0x5B, 0x4D, 0x53, 0x36, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x2B, 0x2F, 0x36, 0x2F, 0x1B, 0x40, 0x2D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x1B, 0x17, 
+  0x14, 0x1D, 0x27, 0x37, 0x37, 0x2D, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x18, 0x15, 0x0D, 0x1C, 0x2D, 0x27, 
+  0x2D, 0x37, 0x37, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x18, 0x1C, 0x18, 0x27, 0x27, 0x20, 0x48, 0x56, 0x56, 
+  0x48, 0x1D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x16, 0x11, 0x11, 0x18, 0x15, 0x15, 0x15, 0x72, 0x74, 0x72, 0x47, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2A, 
+  0x1B, 0x1C, 0x18, 0x20, 0x20, 0x1C, 0x1C, 0x56, 0x7A, 0x5F, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x0C, 0x17, 0x13, 
+  0x19, 0x19, 0x56, 0x74, 0x6F, 0x3B, 0x32, 0x1D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x47, 0x4C, 0x0F, 0x12, 0x36, 0x47, 0x67, 0x67, 
+  0x55, 0x2E, 0x21, 0x17, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x47, 0x38, 0x0F, 0x0C, 0x63, 0x5D, 0x2E, 0x29, 0x16, 0x16, 0x16, 
+  0x16, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x29, 0x19, 0x0B, 0x14, 0x14, 0x1D, 0x1F, 0x19, 0x13, 0x0B, 0x0B, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x0D, 0x0D, 0x13, 0x0E, 0x0E, 0x13, 0x0D, 0x0B, 0x0D, 0x15, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 
+  0x11, 0x11, 0x0B, 0x10, 0x11, 0x0D, 0x0D, 0x11, 0x18, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0x11, 0x15, 0x0D, 
+  0x0B, 0x0B, 0x0D, 0x18, 0x1C, 0x18, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x11, 0x0D, 0x0B, 0x0B, 0x11, 
+  0x18, 0x18, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x11, 0x0D, 0x0B, 0x0D, 0x1C, 0x15, 0x20, 0x15, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x15, 0x11, 0x0D, 0x0B, 0x0B, 0x32, 0x57, 0x3A, 0x0D, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x2C, 0x25, 0x19, 0x13, 0x0B, 0x2C, 0x40, 0x2C, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1D, 
+  0x13, 0x13, 0x13, 0x1D, 0x19, 0x25, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x13, 0x0E, 
+  0x25, 0x32, 0x32, 0x2C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x13, 0x0E, 0x1F, 0x2C, 0x32, 
+  0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2C, 0x19, 0x13, 0x0E, 0x1D, 0x25, 0x3A, 0x12, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x17, 0x25, 0x1D, 0x12, 0x12, 0x00, 0x32, 0x53, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x3A, 0x49, 0x32, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x14, 0x1B, 0x1B, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x65, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x72, 0x6F, 0x6C, 0x6C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x36, 0x5C, 0x63, 0x2A, 0x57, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x45, 0x3B, 0x4F, 0x42, 
+  0x33, 0x57, 0x49, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4A, 0x57, 0x57, 0x57, 0x4D, 0x53, 0x36, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x77, 0x5C, 0x3F, 0x28, 0x2D, 0x27, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x24, 0x2B, 0x38, 0x2E, 0x1D, 0x37, 0x37, 0x34, 0x2D, 0x20, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 
+  0x48, 0x1D, 0x44, 0x3D, 0x70, 0x70, 0x34, 0x3C, 0x37, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x3D, 0x6A, 0x5C, 
+  0x70, 0x70, 0x63, 0x04, 0x70, 0x56, 0x2C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x1D, 0x38, 0x5C, 0x70, 0x3D, 0x50, 
+  0x04, 0x76, 0x67, 0x29, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0x02, 0x6A, 0x3F, 0x70, 0x6A, 0x1C, 0x6A, 0x82, 0x76, 0x48, 
+  0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x02, 0x07, 0x02, 0x13, 0x19, 0x19, 0x6A, 0x82, 0x63, 0x48, 0x25, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x47, 0x04, 
+  0x02, 0x5C, 0x36, 0x5C, 0x80, 0x82, 0x4C, 0x29, 0x14, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x47, 0x38, 0x0F, 0x0C, 0x63, 
+  0x5D, 0x2E, 0x29, 0x16, 0x16, 0x16, 0x16, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0x19, 0x0B, 0x14, 0x14, 0x1D, 0x1F, 
+  0x19, 0x13, 0x0B, 0x0B, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0x0D, 0x13, 0x0E, 0x0E, 0x13, 0x0D, 0x0B, 
+  0x0D, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x11, 0x11, 0x0B, 0x10, 0x0D, 0x0D, 0x0D, 0x11, 0x18, 0x11, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x0D, 0x11, 0x15, 0x0D, 0x0B, 0x0D, 0x11, 0x20, 0x1C, 0x18, 0x0D, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 
+  0x15, 0x11, 0x0D, 0x0B, 0x0D, 0x15, 0x18, 0x18, 0x18, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x0D, 
+  0x0B, 0x15, 0x18, 0x15, 0x20, 0x1C, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x11, 0x0D, 0x0B, 0x0B, 0x6A, 
+  0x70, 0x48, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x1F, 0x19, 0x13, 0x0B, 0x47, 0x4F, 0x2C, 0x1F, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x25, 0x1F, 0x19, 0x13, 0x13, 0x3F, 0x3D, 0x35, 0x2C, 0x1D, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x19, 0x13, 0x0E, 0x00, 0x25, 0x32, 0x32, 0x1D, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x19, 0x13, 0x0E, 0x19, 0x1F, 0x32, 0x2C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2C, 0x19, 0x13, 0x0E, 
+  0x00, 0x35, 0x55, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x25, 0x1D, 0x12, 0x00, 0x00, 0x4C, 0x63, 
+  0x2C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6A, 0x6A, 0x5C, 0x2C, 0x14, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x1B, 0x1B, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x65, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x57, 0x5B, 0x68, 0x65, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x45, 0x2A, 0x39, 0x2A, 0x5B, 0x65, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x41, 0x33, 0x42, 0x33, 0x60, 0x57, 0x4A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0x5B, 0x5B, 
+  0x60, 0x41, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x36, 0x36, 0x1E, 0x30, 0x4B, 
+  0x37, 0x3C, 0x37, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x11, 0x19, 0x19, 0x1F, 0x34, 0x37, 0x2D, 0x27, 0x1D, 
+  0x0F, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x1C, 0x1C, 0x1C, 0x1C, 0x18, 0x20, 0x2D, 0x40, 0x3E, 0x14, 0x0A, 0x11, 0x18, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3D, 
+  0x1F, 0x1D, 0x19, 0x1B, 0x1E, 0x33, 0x28, 0x17, 0x17, 0x5D, 0x76, 0x55, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x1D, 0x19, 0x26, 
+  0x17, 0x17, 0x1E, 0x17, 0x47, 0x3F, 0x55, 0x74, 0x5F, 0x4F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x41, 0x22, 0x17, 0x0F, 0x12, 0x17, 0x12, 
+  0x14, 0x2B, 0x2E, 0x29, 0x35, 0x45, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0x17, 0x0F, 0x12, 0x14, 0x17, 0x0C, 0x25, 0x36, 0x32, 0x2A, 
+  0x14, 0x23, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x1B, 0x12, 0x0C, 0x12, 0x17, 0x12, 0x1D, 0x17, 0x0C, 0x2C, 0x2C, 0x25, 0x25, 0x17, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x0C, 0x0C, 
+  0x21, 0x0F, 0x0A, 0x1D, 0x17, 0x25, 0x1F, 0x1D, 0x1E, 0x19, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x0C, 0x2E, 0x2E, 0x0F, 
+  0x0D, 0x0D, 0x11, 0x15, 0x18, 0x1C, 0x11, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0x0D, 0x11, 
+  0x15, 0x18, 0x15, 0x1F, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x0D, 0x11, 0x20, 0x1C, 0x1C, 
+  0x18, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0x15, 0x18, 0x1C, 0x15, 0x11, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0x15, 0x18, 0x18, 0x18, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x32, 0x40, 0x25, 0x11, 0x0D, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x32, 0x3A, 0x3A, 0x2C, 0x1D, 0x25, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2C, 0x2C, 0x32, 
+  0x32, 0x1D, 0x1F, 0x25, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2C, 0x3A, 0x3A, 0x2C, 0x00, 0x1D, 
+  0x2C, 0x2C, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0x32, 0x2C, 0x25, 0x00, 0x1F, 0x2C, 0x2C, 0x25, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x40, 0x40, 0x25, 0x00, 0x00, 0x32, 0x2C, 0x25, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x68, 0x57, 0x49, 0x32, 0x00, 0x00, 0x1F, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x57, 0x60, 0x49, 0x3A, 
+  0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0x25, 0x1F, 0x1D, 0x17, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x57, 0x60, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3B, 0x4A, 0x40, 
+  0x68, 0x68, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x42, 0x46, 0x49, 0x57, 0x68, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0x3A, 0x42, 0x4E, 0x68, 0x4A, 0x3B, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x3B, 0x45, 0x5B, 0x57, 0x36, 0x3A, 0x1E, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x25, 0x2F, 0x1B, 0x25, 0x2D, 0x34, 0x1D, 0x0F, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x27, 0x1C, 0x15, 0x15, 
+  0x15, 0x32, 0x2A, 0x0C, 0x0D, 0x34, 0x2D, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x24, 0x1C, 0x12, 0x19, 0x32, 0x2A, 0x1E, 
+  0x21, 0x18, 0x25, 0x18, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x15, 0x25, 0x1B, 0x1E, 0x17, 0x5D, 0x6F, 0x41, 0x72, 
+  0x6F, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x14, 0x36, 0x36, 0x17, 0x17, 0x17, 0x19, 0x35, 0x21, 0x29, 0x47, 0x55, 0x40, 0x32, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x12, 0x2A, 
+  0x1B, 0x12, 0x1B, 0x1B, 0x14, 0x1D, 0x18, 0x15, 0x19, 0x1A, 0x23, 0x1D, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x14, 0x14, 0x14, 0x17, 0x17, 
+  0x0F, 0x0C, 0x31, 0x2C, 0x25, 0x2C, 0x16, 0x1D, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x12, 0x0F, 0x1B, 0x1B, 0x0F, 0x12, 0x12, 0x0C, 0x35, 
+  0x1D, 0x1F, 0x19, 0x14, 0x1A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x0C, 0x0C, 0x0C, 0x2F, 0x1A, 0x0C, 0x0D, 0x19, 0x1E, 0x0D, 0x13, 0x11, 0x0D, 
+  0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x0C, 0x0C, 0x29, 0x23, 0x21, 0x0D, 0x0D, 0x19, 0x11, 0x15, 0x11, 0x11, 0x0B, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x11, 0x11, 0x0D, 0x11, 0x18, 0x15, 0x11, 0x19, 0x0D, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x11, 0x15, 0x0D, 0x11, 0x1C, 0x20, 0x15, 0x18, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 
+  0x11, 0x18, 0x1C, 0x18, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x18, 0x18, 0x18, 
+  0x18, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x15, 0x1F, 0x3A, 0x32, 0x15, 0x15, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x25, 0x1F, 0x32, 0x32, 0x25, 0x32, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x1F, 0x1D, 0x1F, 0x1F, 0x25, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x1F, 0x1F, 0x25, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 
+  0x1D, 0x1F, 0x1D, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3A, 0x25, 0x1D, 
+  0x1D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0x5B, 0x32, 0x1D, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x5B, 0x3A, 0x2C, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x1B, 0x22, 0x1B, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4D, 0x60, 0x65, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x3B, 0x3A, 0x40, 0x6C, 0x6C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x28, 0x42, 0x33, 0x40, 0x60, 0x68, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0x42, 0x60, 
+  0x68, 0x57, 0x4A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x36, 0x4A, 0x5B, 0x53, 0x3B, 0x30, 0x30, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x1D, 0x1B, 0x14, 0x2A, 0x27, 0x34, 0x37, 0x34, 0x20, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x18, 0x15, 0x0D, 0x0D, 0x1F, 0x24, 0x25, 0x0F, 0x1C, 0x2D, 0x2D, 0x1C, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1D, 
+  0x13, 0x11, 0x18, 0x32, 0x0F, 0x0F, 0x11, 0x20, 0x27, 0x20, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x21, 0x1D, 0x17, 0x26, 
+  0x1D, 0x19, 0x18, 0x0F, 0x47, 0x5D, 0x38, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x17, 0x1B, 0x14, 0x12, 0x0F, 0x47, 0x55, 0x23, 
+  0x2E, 0x6B, 0x6F, 0x57, 0x4D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x0F, 0x14, 0x17, 0x14, 0x17, 0x17, 0x0F, 0x1A, 0x1A, 0x21, 0x38, 0x67, 0x5D, 
+  0x3D, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 
+  0x14, 0x17, 0x17, 0x17, 0x17, 0x12, 0x14, 0x2F, 0x31, 0x2B, 0x36, 0x12, 0x21, 0x1A, 0x17, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x12, 0x14, 0x1B, 0x14, 
+  0x0F, 0x14, 0x0F, 0x17, 0x38, 0x2E, 0x2C, 0x1E, 0x16, 0x16, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x12, 0x19, 0x12, 0x0F, 0x0C, 0x0B, 0x11, 
+  0x13, 0x1D, 0x1F, 0x14, 0x12, 0x0B, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x21, 0x29, 0x14, 0x0F, 0x11, 0x15, 0x15, 0x1D, 0x19, 
+  0x18, 0x11, 0x0D, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x1C, 0x20, 0x11, 0x0D, 0x11, 0x0D, 0x0D, 
+  0x0D, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x18, 0x1C, 0x18, 0x0D, 0x11, 0x0D, 0x0D, 0x1A, 0x0B, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x11, 0x15, 0x18, 0x18, 0x0D, 0x0D, 0x11, 0x11, 0x11, 0x0D, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x11, 0x15, 0x11, 0x0D, 0x0B, 0x0D, 0x11, 0x11, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x2C, 0x1F, 0x0D, 
+  0x0B, 0x00, 0x0D, 0x0D, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1D, 0x25, 0x1D, 0x19, 0x0F, 0x00, 0x13, 
+  0x1F, 0x19, 0x19, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x1D, 0x1F, 0x1D, 0x00, 0x00, 0x1D, 0x1F, 0x19, 
+  0x2C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x1D, 0x2C, 0x2C, 0x1D, 0x00, 0x00, 0x00, 0x19, 0x1F, 0x25, 0x1D, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x1D, 0x32, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1D, 0x1F, 0x25, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2C, 0x32, 
+  0x2C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x2C, 0x32, 0x1D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4D, 0x32, 0x2C, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x3A, 0x49, 0x2C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x49, 0x60, 0x49, 0x40, 0x32, 0x00, 0x00, 0x00, 0x00, 0x25, 
+  0x32, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x2C, 0x25, 0x17, 0x17, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x57, 0x65, 0x60, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3A, 0x4D, 0x49, 0x6C, 0x68, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x33, 0x54, 0x42, 0x40, 0x60, 0x6C, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x3A, 0x49, 0x46, 0x49, 0x68, 0x4A, 0x4D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 
+  0x45, 0x60, 0x57, 0x36, 0x42, 0x39, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x19, 0x1B, 0x17, 
+  0x32, 0x2D, 0x3C, 0x37, 0x37, 0x2D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x15, 0x11, 0x19, 0x18, 0x2D, 0x37, 0x27, 
+  0x3C, 0x37, 0x34, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x15, 0x18, 0x24, 0x20, 0x2D, 0x2D, 0x20, 0x18, 0x0F, 0x12, 
+  0x2C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x5D, 0x51, 0x19, 0x12, 0x19, 0x25, 0x32, 0x32, 0x0F, 0x0F, 0x3F, 0x67, 0x5D, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2B, 0x14, 
+  0x0B, 0x1D, 0x1E, 0x30, 0x1B, 0x14, 0x0F, 0x21, 0x74, 0x76, 0x5B, 0x49, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x4F, 0x41, 0x1E, 0x12, 0x12, 
+  0x12, 0x0F, 0x2B, 0x21, 0x55, 0x76, 0x6F, 0x4C, 0x2C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x17, 0x17, 0x0F, 0x0F, 0x12, 0x12, 0x0F, 0x23, 0x29, 
+  0x23, 0x21, 0x29, 0x38, 0x1A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x14, 0x0F, 0x0F, 0x12, 0x12, 0x12, 0x0F, 0x0A, 0x21, 0x2E, 0x19, 0x2C, 0x1A, 0x13, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 
+  0x0F, 0x0F, 0x14, 0x0F, 0x12, 0x25, 0x0F, 0x13, 0x25, 0x1C, 0x18, 0x0D, 0x0B, 0x0F, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x38, 
+  0x16, 0x12, 0x11, 0x1D, 0x0D, 0x19, 0x20, 0x18, 0x11, 0x0D, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x18, 
+  0x20, 0x1C, 0x18, 0x20, 0x15, 0x0D, 0x11, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x1C, 0x1C, 0x20, 0x0B, 
+  0x15, 0x15, 0x15, 0x15, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x1C, 0x24, 0x11, 0x11, 0x11, 0x15, 
+  0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x1C, 0x1C, 0x11, 0x11, 0x11, 0x15, 0x15, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x2C, 0x32, 0x1F, 0x19, 0x15, 0x15, 0x15, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x1F, 0x1F, 0x1F, 0x19, 0x1D, 0x25, 0x25, 0x25, 0x2C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0x1D, 
+  0x1F, 0x19, 0x1F, 0x1F, 0x25, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1D, 0x1F, 0x1F, 0x19, 0x00, 
+  0x1F, 0x25, 0x25, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1D, 0x1F, 0x19, 0x00, 0x00, 0x1F, 0x25, 
+  0x32, 0x1D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0x1F, 0x19, 0x19, 0x00, 0x1F, 0x3A, 0x25, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x3A, 0x2C, 0x1F, 0x19, 0x00, 0x2C, 0x32, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x32, 
+  0x40, 0x32, 0x1F, 0x00, 0x00, 0x25, 0x1D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x17, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x65, 0x6C, 0x65, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x30, 0x65, 0x6C, 0x6E, 0x65, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x1B, 0x46, 0x33, 0x65, 0x68, 0x6C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4D, 0x39, 0x6C, 
+  0x57, 0x4D, 0x3B, 0x36, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4D, 0x53, 0x41, 0x33, 0x40, 0x28, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x17, 0x1D, 0x49, 0x58, 0x2D, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x1D, 0x27, 0x34, 0x37, 0x37, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x0D, 0x20, 0x1C, 0x2D, 0x34, 0x34, 0x20, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0x32, 
+  0x5D, 0x72, 0x67, 0x35, 0x0D, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x0F, 0x14, 0x14, 0x14, 0x14, 0x0C, 0x00, 0x3D, 0x63, 0x67, 0x51, 0x29, 
+  0x1A, 0x0F, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x12, 0x12, 0x17, 
+  0x22, 0x1E, 0x22, 0x22, 0x22, 0x22, 0x22, 0x31, 0x4F, 0x57, 0x56, 0x3D, 0x1A, 0x12, 0x0B, 0x11, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x0C, 0x0F, 0x0F, 0x1B, 0x17, 0x17, 
+  0x17, 0x17, 0x1B, 0x51, 0x5D, 0x55, 0x1F, 0x1D, 0x14, 0x12, 0x13, 0x0D, 0x4A, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x0F, 0x0F, 0x2F, 0x2F, 0x6B, 0x4C, 
+  0x2B, 0x23, 0x1A, 0x14, 0x19, 0x13, 0x19, 0x25, 0x3A, 0x32, 0x2C, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x23, 0x1A, 0x38, 0x0C, 0x00, 
+  0x0D, 0x19, 0x12, 0x1D, 0x1D, 0x1F, 0x1A, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x0C, 0x00, 0x00, 0x00, 0x11, 0x19, 0x0D, 
+  0x1C, 0x2D, 0x27, 0x15, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x0D, 0x18, 0x20, 0x24, 0x1C, 
+  0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x15, 0x27, 0x24, 0x24, 0x20, 0x11, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x24, 0x20, 0x18, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x15, 0x1C, 0x20, 0x18, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0x40, 
+  0x1C, 0x18, 0x11, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x32, 0x40, 0x3A, 0x1F, 0x19, 
+  0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x25, 0x2C, 0x25, 0x13, 0x19, 0x1D, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x32, 0x25, 0x3A, 0x32, 0x19, 0x19, 0x19, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x32, 0x32, 0x2C, 0x1D, 0x19, 0x19, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x49, 
+  0x32, 0x1D, 0x13, 0x19, 0x19, 0x25, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x4D, 0x40, 0x32, 0x1D, 
+  0x19, 0x19, 0x1F, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x57, 0x49, 0x3A, 0x32, 0x2C, 0x25, 0x1B, 0x1B, 0x1B, 
+  0x1B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x1B, 0x22, 0x26, 0x1E, 0x1E, 0x22, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5B, 0x6C, 
+  0x68, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x77, 0x6E, 0x6C, 0x68, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x63, 0x49, 0x80, 0x6E, 0x65, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x2A, 0x5B, 0x68, 0x5C, 0x45, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x5C, 0x6B, 0x63, 0x36, 0x3E, 0x30, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x47, 0x38, 
+  0x32, 0x54, 0x54, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6D, 0x6A, 0x37, 0x37, 0x37, 
+  0x2D, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6A, 0x6A, 0x2D, 0x34, 0x34, 0x24, 0x18, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x6A, 0x04, 0x04, 0x67, 0x35, 0x0D, 0x0D, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x79, 0x00, 0x00, 0x00, 0x00, 0x00, 0x62, 0x14, 0x14, 0x14, 0x14, 
+  0x0C, 0x00, 0x6F, 0x04, 0x51, 0x29, 0x1A, 0x0F, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x79, 0x75, 0x79, 0x44, 0x2E, 0x73, 0x41, 0x1E, 0x22, 0x22, 0x22, 0x22, 0x22, 0x3F, 0x79, 
+  0x56, 0x35, 0x21, 0x12, 0x0B, 0x0D, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x79, 0x75, 
+  0x77, 0x21, 0x29, 0x62, 0x3F, 0x17, 0x17, 0x17, 0x17, 0x2B, 0x5C, 0x73, 0x50, 0x1D, 0x14, 0x12, 
+  0x12, 0x0D, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x79, 0x00, 0x00, 0x00, 
+  0x59, 0x12, 0x0F, 0x2F, 0x2E, 0x79, 0x7E, 0x5C, 0x50, 0x1A, 0x17, 0x13, 0x0B, 0x25, 0x3A, 0x32, 
+  0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x21, 0x23, 0x1A, 0x38, 0x0C, 0x0B, 0x19, 0x13, 0x19, 0x1D, 0x1F, 0x1A, 0x19, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 
+  0x0C, 0x00, 0x00, 0x0D, 0x15, 0x11, 0x1C, 0x2D, 0x27, 0x1C, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x15, 0x15, 0x6A, 0x56, 0x1C, 0x20, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x20, 
+  0x6A, 0x56, 0x20, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x56, 0x20, 0x18, 0x11, 
+  0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x48, 0x20, 0x20, 0x0D, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x40, 0x18, 0x15, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x63, 0x40, 0x2C, 0x1D, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x47, 
+  0x2C, 0x2C, 0x1D, 0x13, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5C, 0x55, 0x40, 0x25, 
+  0x13, 0x1D, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x51, 0x2C, 0x25, 0x19, 0x19, 0x1D, 0x1D, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x2C, 0x13, 0x00, 0x19, 0x1D, 0x25, 0x1F, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x63, 0x4D, 0x32, 0x2C, 0x13, 0x19, 0x1D, 0x25, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x63, 0x56, 0x4D, 
+  0x3A, 0x2C, 0x2C, 0x25, 0x1B, 0x1B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x26, 0x22, 0x1E, 0x22, 0x22, 
+  0x1B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5B, 0x6C, 0x65, 0x65, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x3B, 0x60, 0x68, 0x6E, 0x68, 0x53, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x30, 0x33, 0x65, 0x5B, 0x5B, 0x45, 0x4A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x60, 
+  0x53, 0x31, 0x33, 0x2A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x41, 0x2F, 0x31, 0x24, 0x34, 
+  0x37, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x00, 0x35, 0x17, 0x32, 0x24, 0x34, 0x3C, 0x3C, 0x27, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x0F, 0x0A, 0x00, 0x00, 0x15, 0x24, 0x1C, 0x27, 0x37, 0x34, 0x27, 0x1C, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x14, 
+  0x01, 0x00, 0x00, 0x18, 0x20, 0x15, 0x1D, 0x48, 0x3D, 0x4F, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x1E, 0x0F, 0x00, 0x00, 
+  0x15, 0x15, 0x1B, 0x67, 0x7A, 0x6C, 0x6F, 0x2E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x14, 0x1D, 0x3F, 0x5D, 0x6F, 0x3D, 0x5D, 0x76, 
+  0x76, 0x5F, 0x6C, 0x65, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x0C, 0x12, 0x14, 0x21, 0x29, 0x3F, 0x3F, 0x47, 0x47, 0x47, 0x3F, 0x2C, 
+  0x2C, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x0A, 0x12, 0x0F, 0x0F, 0x00, 0x4C, 0x21, 0x1D, 0x1D, 0x19, 0x0B, 0x0B, 0x11, 0x1C, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 
+  0x0F, 0x0F, 0x2E, 0x55, 0x1A, 0x17, 0x19, 0x0B, 0x0B, 0x0B, 0x11, 0x20, 0x1C, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x0C, 0x14, 0x23, 
+  0x38, 0x00, 0x00, 0x0D, 0x11, 0x11, 0x11, 0x15, 0x1C, 0x18, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x0F, 0x23, 0x00, 0x00, 0x00, 
+  0x18, 0x1C, 0x1C, 0x18, 0x18, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x1C, 0x1C, 0x18, 
+  0x18, 0x15, 0x0D, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x18, 0x1C, 0x18, 0x1C, 0x0D, 0x18, 
+  0x1C, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x15, 0x11, 0x15, 0x11, 0x11, 0x1C, 0x20, 0x20, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x15, 0x18, 0x18, 0x18, 0x00, 0x15, 0x18, 0x1C, 0x1C, 0x40, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x32, 
+  0x3A, 0x32, 0x1C, 0x11, 0x00, 0x00, 0x11, 0x15, 0x49, 0x57, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x32, 0x32, 0x3A, 0x2C, 
+  0x00, 0x00, 0x00, 0x00, 0x1D, 0x25, 0x3A, 0x60, 0x49, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0x3A, 0x49, 0x3A, 0x2C, 0x00, 0x00, 
+  0x00, 0x00, 0x1D, 0x1F, 0x2C, 0x49, 0x65, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x32, 0x3A, 0x2C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x32, 0x3A, 0x68, 0x4D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x25, 0x25, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2C, 
+  0x3A, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x49, 
+  0x3A, 0x40, 0x49, 0x2C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x32, 0x40, 0x3A, 0x1F, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x49, 0x60, 0x40, 0x40, 0x40, 
+  0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0x2C, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0x26, 0x26, 0x1B, 0x1E, 0x22, 0x22, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x65, 0x68, 0x65, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4D, 
+  0x6C, 0x6E, 0x6C, 0x68, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2A, 0x5B, 0x6C, 0x6C, 
+  0x65, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3A, 0x4D, 0x53, 0x3B, 0x31, 0x21, 0x2F, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0x4A, 0x36, 0x28, 0x3A, 0x2D, 0x20, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x0F, 0x0C, 0x36, 0x17, 0x25, 0x24, 0x37, 0x43, 0x3C, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x01, 0x00, 
+  0x00, 0x20, 0x24, 0x34, 0x3C, 0x37, 0x20, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0x0F, 0x0A, 0x00, 0x18, 0x20, 0x15, 
+  0x3D, 0x55, 0x4C, 0x51, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0x2F, 0x67, 0x5D, 0x55, 0x19, 0x18, 0x2C, 0x65, 0x68, 0x76, 
+  0x51, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x12, 0x17, 0x2B, 0x47, 0x5D, 0x72, 0x7A, 0x76, 0x6B, 0x60, 0x68, 0x2F, 0x11, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 
+  0x12, 0x16, 0x23, 0x2B, 0x29, 0x2E, 0x2E, 0x2E, 0x2E, 0x2C, 0x19, 0x1D, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x12, 0x0C, 0x0C, 
+  0x67, 0x47, 0x1D, 0x1D, 0x13, 0x13, 0x12, 0x14, 0x1D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x0F, 0x0F, 0x2B, 0x5D, 0x38, 0x1D, 
+  0x13, 0x14, 0x16, 0x12, 0x0D, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x1A, 0x0C, 0x29, 0x4C, 0x00, 0x11, 0x0D, 0x11, 0x11, 
+  0x0D, 0x0D, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x0C, 0x16, 0x00, 0x00, 0x00, 0x15, 0x18, 0x1C, 0x1C, 0x15, 0x11, 0x11, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x20, 0x32, 0x20, 0x15, 0x19, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x18, 0x20, 0x1C, 0x1C, 0x18, 0x18, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x15, 0x20, 0x1C, 0x11, 0x0D, 0x0D, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x1C, 
+  0x15, 0x15, 0x0D, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x32, 0x2C, 0x3A, 0x25, 0x0B, 
+  0x11, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2C, 0x2C, 0x32, 0x25, 0x14, 0x2C, 0x49, 0x40, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0x25, 0x3A, 0x32, 0x1D, 0x1F, 0x32, 0x40, 0x25, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x2C, 0x3A, 0x2C, 0x1F, 0x1F, 0x1F, 0x2C, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x1F, 0x25, 0x1D, 0x00, 0x00, 0x00, 0x2C, 0x40, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x49, 0x40, 0x2C, 
+  0x00, 0x00, 0x49, 0x3A, 0x3A, 0x49, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x5B, 0x49, 0x32, 0x25, 0x2C, 0x32, 
+  0x32, 0x2A, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x49, 0x57, 0x49, 0x3A, 0x2C, 0x1B, 0x00, 0x26, 0x26, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x1E, 0x2A, 0x22, 0x1B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x65, 0x65, 0x57, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x65, 0x6E, 0x6C, 0x65, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x28, 0x57, 0x68, 0x6E, 0x6C, 0x57, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2A, 0x53, 
+  0x53, 0x5B, 0x4D, 0x36, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x57, 0x4D, 0x2F, 0x22, 0x26, 
+  0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x36, 0x2B, 0x1D, 0x2C, 0x2D, 0x37, 0x27, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x12, 0x12, 0x00, 0x00, 0x00, 0x25, 0x24, 0x34, 0x3C, 0x37, 0x24, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x0F, 
+  0x00, 0x00, 0x00, 0x1C, 0x1C, 0x27, 0x2D, 0x2D, 0x24, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x0F, 0x00, 0x00, 0x15, 
+  0x15, 0x19, 0x35, 0x35, 0x3D, 0x35, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x1A, 0x3B, 0x6F, 0x00, 0x00, 0x11, 0x2F, 0x65, 
+  0x74, 0x6B, 0x3F, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x0C, 0x29, 0x3F, 0x4C, 0x6B, 0x6F, 0x74, 0x74, 0x63, 0x65, 0x5B, 0x1F, 
+  0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x0C, 0x14, 0x16, 0x1A, 0x29, 0x2B, 0x2E, 0x29, 0x2E, 0x1F, 0x25, 0x2C, 0x2C, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 
+  0x0F, 0x00, 0x47, 0x1A, 0x16, 0x19, 0x12, 0x12, 0x12, 0x1D, 0x3A, 0x2C, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x14, 0x1A, 0x47, 
+  0x21, 0x00, 0x19, 0x12, 0x16, 0x14, 0x13, 0x15, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x23, 0x21, 0x00, 0x00, 0x00, 0x1D, 
+  0x19, 0x0D, 0x15, 0x18, 0x18, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x18, 
+  0x18, 0x18, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x15, 0x2C, 0x1C, 0x18, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x11, 0x11, 0x18, 0x18, 0x15, 0x11, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x15, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 
+  0x1D, 0x11, 0x0B, 0x11, 0x11, 0x18, 0x1C, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x1F, 0x19, 0x13, 
+  0x19, 0x1D, 0x19, 0x25, 0x3A, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1D, 0x1F, 0x19, 0x13, 0x1D, 0x1F, 
+  0x19, 0x32, 0x49, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0x2C, 0x1D, 0x13, 0x00, 0x00, 0x19, 0x1D, 0x2C, 
+  0x2C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x2C, 0x25, 0x1D, 0x00, 0x00, 0x00, 0x00, 0x13, 0x19, 0x1F, 0x40, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x32, 0x2C, 0x1D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x32, 0x32, 0x40, 0x1B, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x49, 0x4D, 0x3A, 0x3A, 
+  0x1D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3A, 0x49, 0x32, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2A, 0x32, 0x2C, 0x26, 0x2A, 0x1E, 0x00, 0x00, 
+  0x00, 0x00, 0x3A, 0x40, 0x32, 0x1B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 
+  0x1B, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x68, 
+  0x68, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5B, 0x60, 0x6C, 0x6E, 0x68, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x4D, 0x60, 0x6C, 0x6E, 0x60, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x39, 0x30, 0x5B, 0x4A, 0x4D, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x53, 0x5B, 0x65, 0x4D, 0x22, 0x40, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x36, 
+  0x1F, 0x28, 0x24, 0x34, 0x34, 0x2D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1D, 0x20, 0x27, 
+  0x37, 0x43, 0x43, 0x2D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x15, 0x24, 0x1C, 0x2D, 0x37, 0x3C, 
+  0x2D, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x0F, 0x0A, 0x00, 0x00, 0x11, 0x1C, 0x11, 0x19, 0x48, 0x48, 0x6B, 0x25, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 
+  0x12, 0x01, 0x00, 0x00, 0x29, 0x15, 0x0D, 0x4C, 0x7A, 0x7A, 0x72, 0x25, 0x18, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x1B, 0x12, 0x12, 0x3B, 
+  0x00, 0x19, 0x3D, 0x63, 0x76, 0x60, 0x6C, 0x57, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x12, 0x12, 0x2B, 0x55, 0x74, 0x72, 0x72, 
+  0x6F, 0x67, 0x5D, 0x2C, 0x32, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x12, 0x1A, 0x2E, 0x2B, 0x16, 0x29, 0x23, 0x21, 0x16, 
+  0x16, 0x1D, 0x3A, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x0F, 0x0F, 0x12, 0x31, 0x2F, 0x00, 0x17, 0x19, 0x12, 0x0B, 0x0B, 0x0D, 0x24, 
+  0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x0F, 0x38, 0x1A, 0x17, 0x00, 0x00, 0x19, 0x0D, 0x0D, 0x11, 0x11, 0x1C, 0x18, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 
+  0x0F, 0x00, 0x00, 0x00, 0x15, 0x11, 0x18, 0x1C, 0x20, 0x0B, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x11, 0x15, 0x15, 0x20, 0x20, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x18, 
+  0x1C, 0x1C, 0x1C, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x15, 0x18, 0x18, 0x0D, 
+  0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x15, 0x18, 0x1C, 0x1C, 0x11, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x1F, 0x25, 0x1F, 0x15, 0x11, 0x1C, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x25, 0x1F, 0x2C, 0x2C, 0x25, 0x40, 0x57, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x1F, 0x1F, 0x1D, 0x25, 0x32, 0x40, 0x2C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x1D, 
+  0x1D, 0x1F, 0x1F, 0x32, 0x57, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x13, 0x19, 0x32, 
+  0x49, 0x40, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x19, 0x1D, 0x57, 0x49, 0x30, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x25, 0x25, 0x1F, 0x1D, 0x2C, 0x40, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x14, 0x14, 0x14, 0x14, 0x17, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0x65, 0x65, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x60, 0x6C, 0x6E, 0x6E, 0x65, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x40, 0x65, 0x6C, 0x68, 0x5B, 0x4A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4D, 0x5B, 0x36, 
+  0x31, 0x2B, 0x36, 0x36, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x3B, 0x31, 0x30, 0x39, 0x30, 0x26, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x2D, 0x3C, 0x3C, 0x34, 0x27, 0x1C, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x20, 0x34, 0x34, 0x34, 0x2D, 0x27, 0x2D, 0x27, 0x27, 0x20, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x1C, 0x2D, 0x2D, 0x27, 0x24, 0x20, 0x24, 0x1C, 0x1C, 0x2C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x0C, 0x0C, 0x0C, 0x5D, 0x51, 0x3F, 0x16, 
+  0x0F, 0x0D, 0x1C, 0x1C, 0x18, 0x15, 0x1D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x14, 0x17, 0x28, 0x28, 0x4D, 0x3D, 0x2B, 0x1A, 0x10, 0x12, 0x0D, 0x18, 
+  0x18, 0x18, 0x15, 0x19, 0x1A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x0F, 0x0F, 0x0F, 0x17, 0x2A, 
+  0x2A, 0x1B, 0x17, 0x17, 0x2F, 0x32, 0x4A, 0x1D, 0x16, 0x0B, 0x0D, 0x11, 0x15, 0x1C, 0x15, 0x11, 
+  0x16, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x12, 0x12, 0x12, 0x14, 
+  0x2F, 0x38, 0x1D, 0x11, 0x0D, 0x0F, 0x14, 0x1F, 0x32, 0x40, 0x2C, 0x40, 0x2A, 0x19, 0x1F, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x29, 0x21, 
+  0x00, 0x23, 0x21, 0x25, 0x32, 0x2C, 0x2C, 0x2C, 0x3A, 0x32, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x23, 0x14, 0x00, 0x00, 0x1A, 
+  0x18, 0x18, 0x18, 0x0B, 0x15, 0x1C, 0x18, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x1C, 0x27, 0x2D, 
+  0x18, 0x1C, 0x1C, 0x15, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x20, 0x3D, 0x18, 0x15, 0x15, 0x0D, 
+  0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x20, 0x20, 0x15, 0x11, 0x0D, 0x0B, 0x0D, 0x11, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x11, 0x20, 0x11, 0x11, 0x11, 0x11, 0x0B, 0x0D, 0x0D, 0x18, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 
+  0x24, 0x18, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x11, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x32, 0x11, 0x11, 0x11, 
+  0x00, 0x00, 0x12, 0x14, 0x1F, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1D, 0x32, 0x32, 0x19, 0x0D, 0x00, 0x00, 0x17, 
+  0x17, 0x1F, 0x3A, 0x2C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x2C, 0x3A, 0x32, 0x2C, 0x19, 0x00, 0x00, 0x00, 0x1D, 0x1F, 0x32, 
+  0x2C, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x2C, 0x32, 0x2C, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1D, 0x25, 0x2C, 0x1D, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1D, 
+  0x1F, 0x1D, 0x1D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x2C, 0x40, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x60, 0x4D, 0x3A, 0x2C, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x32, 0x25, 0x2C, 0x32, 0x2C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3A, 0x40, 0x40, 0x3A, 0x2C, 0x25, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x1E, 0x1B, 0x22, 0x2A, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x1B, 0x22, 0x1E, 0x1E, 0x1E, 0x1B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5B, 0x68, 
+  0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x73, 0x6E, 0x6E, 0x6E, 0x68, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5C, 0x76, 0x6E, 0x68, 0x65, 0x4D, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x53, 0x5D, 0x36, 0x2F, 0x2F, 0x36, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x5C, 0x3F, 0x36, 0x33, 0x3A, 0x2A, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x37, 0x3C, 
+  0x37, 0x2D, 0x32, 0x18, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x34, 0x34, 0x2D, 0x27, 0x2D, 0x27, 
+  0x27, 0x27, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x70, 0x2D, 0x27, 0x24, 0x20, 0x24, 0x1C, 0x1C, 0x18, 0x18, 
+  0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 
+  0x0C, 0x0C, 0x82, 0x5C, 0x23, 0x10, 0x0D, 0x1C, 0x1C, 0x18, 0x18, 0x15, 0x15, 0x2E, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x80, 0x73, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0x17, 0x28, 0x5D, 0x69, 
+  0x21, 0x16, 0x12, 0x0D, 0x18, 0x18, 0x18, 0x18, 0x15, 0x11, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x70, 0x08, 0x6A, 0x29, 0x0F, 0x44, 0x4C, 0x2A, 0x1B, 0x17, 0x17, 0x79, 0x1D, 0x16, 0x13, 0x0B, 
+  0x0D, 0x15, 0x1C, 0x18, 0x15, 0x11, 0x13, 0x29, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x73, 
+  0x00, 0x00, 0x52, 0x29, 0x12, 0x12, 0x14, 0x2B, 0x38, 0x0D, 0x0D, 0x0F, 0x1D, 0x2C, 0x32, 0x3A, 
+  0x32, 0x40, 0x2A, 0x0F, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x5C, 0x44, 0x21, 0x23, 0x2B, 0x2C, 0x40, 0x25, 0x2C, 0x2C, 0x3A, 0x32, 
+  0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x23, 0x14, 0x00, 0x1F, 0x15, 0x18, 0x11, 0x0B, 0x15, 0x1C, 0x18, 0x0B, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x0F, 0x00, 0x6A, 0x70, 0x27, 0x24, 0x18, 0x1C, 0x1C, 0x15, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 
+  0x32, 0x20, 0x11, 0x18, 0x15, 0x0D, 0x0D, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x56, 0x20, 0x18, 0x11, 
+  0x11, 0x0D, 0x0B, 0x0D, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6A, 0x1C, 0x11, 0x11, 0x0D, 0x11, 0x0B, 0x0D, 
+  0x0D, 0x15, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x5C, 0x20, 0x18, 0x0D, 0x0D, 0x19, 0x0D, 0x0D, 0x0D, 0x15, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x5C, 0x11, 0x11, 0x11, 0x00, 0x00, 0x12, 0x14, 0x1F, 0x25, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x77, 0x55, 
+  0x32, 0x19, 0x0D, 0x00, 0x00, 0x44, 0x17, 0x1F, 0x3A, 0x2C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x77, 0x55, 0x32, 0x2C, 0x19, 
+  0x00, 0x00, 0x00, 0x29, 0x1F, 0x32, 0x2C, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x79, 0x4C, 0x2C, 0x1F, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x1D, 0x25, 0x2C, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x1F, 0x1D, 0x1D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 
+  0x32, 0x3A, 0x2C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x80, 0x80, 0x7E, 0x3A, 0x2C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5C, 0x25, 0x25, 0x3A, 0x2C, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5D, 0x40, 0x40, 0x4F, 
+  0x2C, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x1B, 0x17, 0x14, 0x17, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0x22, 0x1E, 0x1E, 0x1E, 0x1B, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x68, 0x6C, 0x68, 0x60, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4D, 0x68, 0x6C, 0x60, 0x60, 0x53, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x3B, 0x41, 0x45, 0x45, 0x4D, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x3B, 0x25, 0x2D, 0x49, 0x40, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 
+  0x2D, 0x3C, 0x34, 0x2D, 0x27, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x1B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x34, 0x3C, 0x34, 
+  0x27, 0x27, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x01, 0x0F, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x35, 0x4F, 0x3D, 0x18, 0x24, 0x20, 
+  0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 
+  0x12, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x67, 0x6B, 0x6F, 0x4C, 0x15, 0x24, 0x20, 0x18, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x5D, 0x51, 
+  0x67, 0x6B, 0x67, 0x68, 0x6E, 0x56, 0x19, 0x20, 0x24, 0x20, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x4C, 0x4C, 0x4C, 0x51, 0x5D, 
+  0x3B, 0x32, 0x2C, 0x18, 0x1C, 0x18, 0x19, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x1A, 0x23, 0x23, 0x23, 0x2E, 0x1B, 0x14, 
+  0x3A, 0x49, 0x5B, 0x49, 0x40, 0x2C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x0F, 0x0F, 0x29, 0x14, 0x1D, 0x25, 0x27, 0x2D, 
+  0x20, 0x18, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x0F, 0x12, 0x12, 0x0B, 0x11, 0x18, 0x1C, 0x18, 0x20, 0x15, 0x20, 0x27, 
+  0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x0C, 0x0F, 0x11, 0x1C, 0x24, 0x1C, 0x18, 0x11, 0x0D, 0x18, 0x18, 0x15, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x15, 0x2E, 0x1C, 0x1C, 0x1C, 0x0D, 0x15, 0x27, 0x20, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x48, 
+  0x1C, 0x20, 0x18, 0x11, 0x18, 0x27, 0x27, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x1C, 0x1C, 0x15, 
+  0x15, 0x18, 0x24, 0x27, 0x27, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x18, 0x15, 0x11, 0x18, 0x1C, 0x24, 
+  0x20, 0x20, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x32, 0x3A, 0x2C, 0x25, 0x00, 0x00, 0x15, 0x1C, 0x57, 0x68, 0x65, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x40, 0x32, 0x2C, 0x1F, 0x00, 0x00, 0x00, 0x1F, 0x32, 0x68, 0x6E, 0x68, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2C, 
+  0x49, 0x3A, 0x2C, 0x00, 0x00, 0x00, 0x00, 0x25, 0x32, 0x60, 0x6E, 0x49, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2C, 0x40, 0x40, 0x25, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x32, 0x5B, 0x5B, 0x53, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0x32, 0x32, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x3B, 0x60, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x49, 0x2C, 0x3A, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x41, 0x25, 0x1B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x2A, 0x32, 0x40, 0x40, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x32, 0x26, 0x17, 
+  0x1B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x22, 0x22, 0x1E, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x17, 0x17, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x68, 0x65, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x68, 0x6E, 0x6E, 0x68, 0x53, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x65, 0x6E, 0x6C, 0x65, 0x60, 0x57, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4A, 
+  0x41, 0x3B, 0x36, 0x45, 0x36, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2B, 0x1F, 0x27, 0x2D, 
+  0x3E, 0x2A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x0C, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2D, 0x3C, 0x3C, 0x37, 0x2D, 0x2D, 0x27, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 
+  0x0F, 0x00, 0x00, 0x00, 0x00, 0x20, 0x34, 0x3C, 0x3C, 0x2D, 0x20, 0x27, 0x24, 0x20, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x17, 0x14, 
+  0x00, 0x00, 0x1F, 0x1F, 0x4F, 0x48, 0x18, 0x18, 0x24, 0x1C, 0x1C, 0x15, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0x3B, 0x17, 0x12, 0x00, 0x60, 
+  0x6B, 0x72, 0x4C, 0x1A, 0x1C, 0x20, 0x18, 0x18, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5D, 0x74, 0x5D, 0x6B, 0x72, 0x65, 0x68, 0x48, 0x1A, 
+  0x15, 0x20, 0x20, 0x20, 0x18, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x51, 0x4C, 0x47, 0x51, 0x2C, 0x3A, 0x2C, 0x12, 0x18, 0x1C, 0x11, 
+  0x0B, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x12, 0x0F, 0x12, 0x19, 0x14, 0x3A, 0x45, 0x49, 0x53, 0x49, 0x40, 0x32, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x17, 0x12, 0x12, 0x0F, 0x13, 0x19, 0x2C, 0x1C, 0x2D, 0x27, 0x18, 0x18, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x0F, 
+  0x12, 0x12, 0x0D, 0x18, 0x15, 0x1C, 0x18, 0x18, 0x0D, 0x1C, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x1C, 
+  0x20, 0x20, 0x18, 0x15, 0x11, 0x0D, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x25, 0x18, 0x18, 
+  0x18, 0x0B, 0x0B, 0x11, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x20, 0x18, 0x24, 0x15, 0x0B, 0x0D, 
+  0x15, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x11, 0x11, 0x15, 0x0D, 0x0B, 0x11, 0x15, 0x11, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x18, 0x18, 0x1C, 0x15, 0x0D, 0x0D, 0x18, 0x1C, 0x15, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x18, 0x20, 0x18, 0x11, 0x11, 0x1D, 0x4A, 0x40, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x32, 0x32, 0x3A, 
+  0x25, 0x00, 0x19, 0x2C, 0x65, 0x65, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0x3A, 0x40, 0x2C, 0x25, 0x00, 
+  0x25, 0x49, 0x49, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x32, 0x32, 0x2C, 0x1F, 0x00, 0x00, 0x25, 0x49, 
+  0x49, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0x25, 0x1D, 0x00, 0x00, 0x00, 0x00, 0x32, 0x49, 0x32, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x1F, 0x32, 0x2C, 0x00, 0x00, 0x00, 0x00, 0x2C, 0x49, 0x32, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 
+  0x40, 0x3A, 0x00, 0x00, 0x00, 0x3A, 0x2C, 0x1F, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3A, 0x2C, 0x28, 0x25, 0x1D, 
+  0x00, 0x00, 0x25, 0x1B, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x1E, 0x14, 0x14, 0x14, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x6C, 0x6C, 0x6C, 0x65, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x57, 0x6C, 0x6E, 0x68, 
+  0x68, 0x53, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3B, 0x4D, 0x4A, 0x4A, 0x4D, 0x36, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0x2F, 0x49, 0x4B, 0x40, 0x30, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x35, 0x20, 0x34, 0x3C, 0x37, 0x34, 0x2D, 0x27, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 
+  0x2D, 0x34, 0x37, 0x34, 0x34, 0x2D, 0x27, 0x27, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x0A, 0x0C, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x27, 0x27, 0x27, 
+  0x24, 0x2D, 0x27, 0x24, 0x20, 0x20, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x01, 0x17, 0x1E, 0x17, 0x0A, 0x00, 0x1A, 0x5D, 0x5D, 0x21, 0x18, 0x27, 0x24, 
+  0x24, 0x1C, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x12, 0x41, 0x3B, 0x2F, 0x2F, 0x45, 0x53, 0x55, 0x47, 0x1A, 0x15, 0x20, 0x20, 0x20, 0x1C, 0x15, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x23, 0x51, 0x67, 
+  0x55, 0x6B, 0x45, 0x60, 0x49, 0x1D, 0x11, 0x18, 0x1C, 0x18, 0x11, 0x11, 0x15, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0x38, 0x3F, 0x38, 0x19, 
+  0x1D, 0x19, 0x19, 0x32, 0x40, 0x2C, 0x3A, 0x4D, 0x3A, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x0F, 0x0C, 0x0F, 0x1D, 
+  0x32, 0x49, 0x32, 0x40, 0x49, 0x32, 0x2C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x0F, 0x0C, 0x0F, 0x12, 0x13, 0x12, 0x20, 
+  0x20, 0x24, 0x18, 0x1C, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x14, 0x0F, 0x1D, 0x24, 0x1C, 0x20, 0x20, 0x20, 0x15, 
+  0x15, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x24, 0x27, 0x15, 0x15, 0x0D, 0x0D, 0x0D, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x18, 0x32, 0x27, 0x24, 0x20, 0x0D, 0x0D, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x1C, 0x1C, 0x1C, 0x20, 0x18, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0x15, 
+  0x15, 0x1C, 0x18, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x1C, 0x20, 0x27, 0x1C, 
+  0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1D, 0x25, 0x3A, 0x3A, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0x2C, 0x2C, 0x5B, 0x57, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x1D, 0x1F, 0x2C, 0x40, 0x49, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x13, 0x13, 0x1D, 0x25, 0x32, 0x49, 0x2C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x19, 0x13, 
+  0x1D, 0x1F, 0x40, 0x4D, 0x49, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x32, 0x1F, 0x13, 0x1D, 0x00, 0x1B, 0x2C, 
+  0x40, 0x40, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0x25, 0x19, 0x13, 0x19, 0x00, 0x32, 0x2C, 0x1E, 0x1B, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x13, 0x12, 0x14, 0x12, 0x1F, 0x2C, 0x1E, 0x1B, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x1F, 0x1B, 0x1B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6C, 0x68, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x68, 0x6C, 0x6E, 0x6E, 0x6C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x68, 
+  0x6E, 0x6E, 0x68, 0x68, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x41, 0x41, 0x4D, 
+  0x4D, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x23, 0x25, 0x34, 0x3C, 0x54, 0x42, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x3C, 0x3C, 0x3C, 0x37, 0x3C, 0x34, 0x27, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x1C, 0x34, 0x3C, 0x43, 0x3C, 0x34, 0x37, 0x2D, 0x2D, 0x24, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 
+  0x18, 0x3A, 0x56, 0x2C, 0x20, 0x34, 0x27, 0x27, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x0C, 0x0F, 0x17, 0x1B, 0x12, 0x00, 0x00, 0x00, 0x51, 0x72, 0x6F, 
+  0x47, 0x1C, 0x2D, 0x27, 0x24, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x0C, 0x17, 0x41, 0x1E, 0x17, 0x5D, 0x4F, 0x5F, 0x6B, 0x47, 0x1F, 0x20, 0x24, 
+  0x27, 0x1C, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x2B, 0x63, 0x6F, 0x67, 0x6F, 0x4F, 0x53, 0x49, 0x2C, 0x18, 0x1C, 0x18, 0x1D, 0x1E, 0x1D, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x47, 0x3F, 
+  0x38, 0x29, 0x2E, 0x2B, 0x1F, 0x19, 0x1F, 0x2C, 0x57, 0x65, 0x65, 0x60, 0x49, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 
+  0x0C, 0x0C, 0x0D, 0x25, 0x3A, 0x24, 0x24, 0x34, 0x2D, 0x1F, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x0C, 0x23, 0x0D, 
+  0x15, 0x27, 0x2D, 0x2D, 0x27, 0x24, 0x15, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x0F, 0x0D, 0x24, 0x24, 0x15, 
+  0x15, 0x18, 0x18, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x48, 0x24, 0x15, 0x1C, 0x11, 0x0D, 
+  0x1C, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0x24, 0x2D, 0x24, 0x2D, 0x11, 0x11, 0x15, 0x11, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x0D, 0x15, 0x15, 0x18, 0x18, 0x11, 0x11, 0x1C, 0x15, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x1C, 0x24, 0x2D, 0x20, 0x15, 0x1C, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x18, 
+  0x40, 0x40, 0x2C, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x3A, 0x49, 0x65, 0x65, 
+  0x49, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1D, 0x3A, 0x60, 0x6C, 0x57, 0x3A, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0x32, 0x53, 0x65, 0x49, 0x32, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0x4D, 0x60, 0x57, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x25, 0x3A, 0x49, 0x60, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2C, 
+  0x40, 0x49, 0x32, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2C, 0x1D, 0x32, 0x28, 0x17, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x17, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x65, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x6C, 0x6C, 0x6C, 0x6C, 0x68, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x65, 0x6C, 0x65, 0x65, 0x68, 0x60, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x45, 0x2F, 0x2F, 
+  0x3B, 0x3B, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x2A, 0x42, 0x42, 0x42, 0x39, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x37, 0x3C, 0x34, 0x34, 0x34, 0x34, 0x34, 0x37, 0x2D, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x27, 0x37, 0x3C, 0x34, 0x37, 0x37, 0x34, 0x2D, 0x34, 0x27, 0x2D, 0x20, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x24, 
+  0x24, 0x27, 0x2D, 0x2D, 0x27, 0x24, 0x20, 0x24, 0x20, 0x11, 0x23, 0x55, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x13, 0x13, 0x18, 0x24, 
+  0x24, 0x20, 0x20, 0x20, 0x1C, 0x1C, 0x11, 0x38, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2B, 0x23, 0x16, 0x16, 0x19, 0x20, 0x20, 0x20, 0x24, 
+  0x20, 0x1C, 0x15, 0x13, 0x1A, 0x23, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x0F, 0x0F, 0x0F, 0x2A, 0x23, 0x10, 0x16, 0x11, 0x15, 0x1C, 0x1D, 0x19, 0x19, 0x15, 0x11, 
+  0x10, 0x13, 0x1A, 0x2E, 0x4D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x1D, 0x1D, 0x19, 0x16, 0x2C, 0x2C, 0x32, 0x40, 0x40, 0x40, 0x3B, 0x1D, 0x16, 0x16, 0x1D, 
+  0x1F, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x2E, 0x21, 0x2C, 0x4A, 0x25, 0x40, 0x49, 0x32, 0x1F, 0x20, 0x19, 0x16, 0x1D, 0x1D, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0x15, 
+  0x0D, 0x1C, 0x1C, 0x20, 0x15, 0x15, 0x1C, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x27, 0x1C, 0x18, 0x18, 
+  0x18, 0x0D, 0x0D, 0x0D, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0x15, 0x18, 0x11, 0x0D, 0x0D, 0x0B, 0x15, 
+  0x18, 0x15, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x11, 0x1F, 0x18, 0x11, 0x11, 0x0D, 0x0D, 0x0D, 0x18, 0x18, 0x18, 0x18, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x0B, 0x11, 0x11, 0x15, 0x11, 0x11, 0x00, 0x11, 0x15, 0x18, 0x20, 0x18, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0x15, 
+  0x11, 0x11, 0x11, 0x00, 0x00, 0x0D, 0x15, 0x1C, 0x1C, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2C, 0x15, 0x15, 0x11, 0x00, 
+  0x00, 0x00, 0x00, 0x11, 0x32, 0x3A, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3A, 0x25, 0x1D, 0x19, 0x00, 0x00, 0x00, 0x00, 
+  0x1D, 0x32, 0x49, 0x49, 0x2C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x32, 0x2C, 0x2C, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0x40, 
+  0x49, 0x2C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x25, 0x25, 0x25, 0x1D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x2C, 0x32, 0x1E, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2C, 
+  0x25, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x32, 0x2C, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3A, 0x32, 0x32, 0x1F, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0x32, 0x32, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x2C, 0x3A, 0x40, 0x2C, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x17, 0x2C, 0x53, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0x22, 0x22, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x17, 0x22, 0x1B, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 
+  0x65, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x6C, 0x6C, 0x6C, 0x68, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x82, 0x6C, 0x65, 0x65, 0x68, 0x60, 0x45, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x77, 0x2F, 0x2F, 0x3B, 0x3B, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x50, 0x4C, 0x42, 0x42, 0x42, 0x39, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x37, 0x3C, 0x3C, 
+  0x34, 0x34, 0x34, 0x34, 0x34, 0x37, 0x2D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6A, 0x37, 0x3C, 0x34, 0x37, 0x3C, 0x34, 0x34, 
+  0x2D, 0x34, 0x27, 0x2D, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x70, 0x24, 0x24, 0x27, 0x2D, 0x2D, 0x27, 0x24, 0x24, 0x20, 0x24, 0x20, 
+  0x11, 0x23, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x5C, 0x29, 0x13, 0x18, 0x24, 0x24, 0x20, 0x20, 0x20, 0x20, 0x1C, 0x1C, 0x11, 0x38, 0x55, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x6D, 0x00, 0x71, 0x23, 
+  0x16, 0x19, 0x20, 0x20, 0x20, 0x27, 0x24, 0x20, 0x1C, 0x15, 0x13, 0x1A, 0x23, 0x23, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6A, 0x08, 0x5C, 0x0C, 0x66, 0x29, 0x16, 0x11, 0x15, 
+  0x1C, 0x1D, 0x19, 0x19, 0x19, 0x15, 0x11, 0x10, 0x13, 0x1A, 0x2E, 0x4D, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x6D, 0x00, 0x62, 0x29, 0x1A, 0x2C, 0x2C, 0x32, 0x3A, 0x4D, 
+  0x40, 0x40, 0x3B, 0x1D, 0x16, 0x16, 0x1D, 0x1F, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x2C, 0x32, 0x32, 0x40, 0x49, 0x3A, 0x25, 0x32, 
+  0x20, 0x16, 0x16, 0x1D, 0x1D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x0D, 0x1C, 0x1C, 0x20, 0x15, 0x15, 0x20, 0x20, 0x0D, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x48, 0x20, 0x18, 0x18, 0x18, 0x0D, 0x11, 0x15, 0x15, 0x0D, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6A, 0x1F, 
+  0x11, 0x15, 0x11, 0x0D, 0x0B, 0x0D, 0x11, 0x11, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5C, 0x18, 0x18, 0x11, 0x0D, 
+  0x0D, 0x0D, 0x15, 0x18, 0x18, 0x18, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x47, 0x1F, 0x11, 0x15, 0x0D, 0x00, 0x0D, 0x0D, 
+  0x18, 0x18, 0x20, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x5C, 0x38, 0x11, 0x0D, 0x0D, 0x11, 0x00, 0x00, 0x11, 0x18, 0x20, 0x20, 
+  0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x79, 0x3D, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x15, 0x18, 0x15, 0x11, 0x0D, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x73, 0x25, 
+  0x1D, 0x19, 0x13, 0x00, 0x00, 0x00, 0x00, 0x25, 0x57, 0x57, 0x2C, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x2C, 0x2C, 0x1F, 0x1D, 
+  0x00, 0x00, 0x00, 0x00, 0x1D, 0x3A, 0x49, 0x40, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5C, 0x25, 0x25, 0x1D, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x25, 0x32, 0x32, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x5C, 0x25, 0x1D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x2C, 0x3A, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x73, 0x5C, 0x32, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x32, 0x40, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x32, 
+  0x40, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x28, 0x2C, 0x1F, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x1E, 0x22, 0x1B, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x12, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x57, 0x57, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x57, 
+  0x68, 0x6C, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x57, 0x5B, 0x60, 0x68, 0x60, 
+  0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x41, 0x4D, 0x41, 0x36, 0x2F, 0x1B, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x20, 0x27, 0x27, 0x49, 0x49, 0x42, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x2D, 0x37, 0x37, 0x2D, 0x37, 0x37, 0x34, 0x2D, 0x2D, 0x2D, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x0F, 0x00, 0x00, 0x00, 0x18, 0x24, 0x20, 0x27, 
+  0x2D, 0x37, 0x2D, 0x34, 0x2D, 0x27, 0x27, 0x20, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x0A, 0x0F, 0x0F, 0x00, 0x55, 0x6F, 0x4C, 0x18, 0x34, 0x34, 0x2D, 
+  0x2D, 0x24, 0x27, 0x20, 0x23, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x01, 0x22, 0x60, 0x48, 0x47, 0x23, 0x15, 0x27, 0x34, 0x27, 0x27, 0x24, 0x24, 
+  0x1C, 0x38, 0x2E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x3F, 0x3B, 0x57, 0x36, 0x23, 0x18, 0x18, 0x19, 0x19, 0x19, 0x11, 0x18, 0x11, 0x2E, 0x29, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x23, 0x23, 
+  0x1F, 0x1F, 0x3A, 0x25, 0x41, 0x65, 0x68, 0x65, 0x53, 0x25, 0x25, 0x36, 0x2C, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 
+  0x1C, 0x27, 0x24, 0x1C, 0x20, 0x34, 0x27, 0x3A, 0x2C, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x18, 0x1C, 0x18, 
+  0x18, 0x24, 0x27, 0x24, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x15, 0x15, 0x11, 0x0D, 0x15, 0x18, 
+  0x18, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x15, 0x15, 0x18, 0x11, 0x24, 0x2D, 0x24, 0x27, 0x1C, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x18, 0x18, 0x15, 0x18, 0x15, 0x24, 0x2D, 0x34, 0x20, 0x1C, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x18, 0x18, 0x15, 0x15, 0x15, 0x20, 0x2D, 0x27, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 
+  0x18, 0x15, 0x40, 0x49, 0x32, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x18, 0x15, 0x32, 0x6C, 
+  0x68, 0x57, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x32, 0x2C, 0x2C, 0x40, 0x6C, 0x6C, 0x40, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x32, 0x40, 0x40, 0x32, 0x6C, 0x65, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x2C, 0x3A, 0x2C, 0x40, 0x68, 0x49, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 
+  0x32, 0x2C, 0x32, 0x33, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2C, 0x49, 0x3A, 0x1B, 
+  0x17, 0x2C, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2C, 0x40, 0x32, 0x17, 0x17, 0x17, 0x2C, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x17, 0x22, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5B, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x65, 0x6C, 0x68, 0x57, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5B, 0x57, 0x65, 0x60, 0x4A, 0x36, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x2B, 0x3B, 0x45, 0x3B, 0x2B, 0x2B, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x3C, 0x27, 0x54, 0x49, 0x4E, 0x46, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x27, 0x3C, 0x43, 0x37, 0x3C, 
+  0x43, 0x3C, 0x34, 0x34, 0x34, 0x2D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x0C, 0x14, 0x00, 0x20, 0x2D, 0x34, 0x37, 0x37, 0x3C, 0x34, 0x34, 0x27, 
+  0x2D, 0x27, 0x24, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x01, 0x21, 0x48, 0x48, 0x1F, 0x20, 0x34, 0x2D, 0x27, 0x2D, 0x24, 0x27, 0x20, 0x11, 
+  0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x63, 0x5D, 0x5D, 0x38, 0x18, 0x2D, 0x27, 0x24, 0x27, 0x20, 0x20, 0x1C, 0x13, 0x2E, 0x21, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4D, 0x65, 0x4F, 0x23, 
+  0x16, 0x15, 0x20, 0x24, 0x1C, 0x1C, 0x1C, 0x1C, 0x11, 0x13, 0x2B, 0x10, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2C, 0x2C, 0x25, 0x1F, 0x18, 0x11, 
+  0x1F, 0x30, 0x30, 0x26, 0x19, 0x0D, 0x13, 0x2F, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x32, 0x3A, 0x49, 0x60, 0x65, 0x65, 
+  0x57, 0x40, 0x22, 0x19, 0x32, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x15, 0x24, 0x2D, 0x18, 0x15, 0x20, 0x34, 0x20, 
+  0x21, 0x1D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x27, 0x18, 0x18, 0x15, 0x0D, 0x15, 0x24, 0x20, 0x1C, 0x18, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x18, 0x1C, 0x11, 0x0D, 0x0B, 0x0D, 0x11, 0x11, 0x11, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5D, 0x1C, 0x1C, 
+  0x18, 0x0D, 0x0D, 0x15, 0x18, 0x11, 0x0D, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x1C, 0x15, 0x15, 0x0D, 
+  0x18, 0x1C, 0x18, 0x20, 0x1D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x15, 0x11, 0x11, 0x11, 0x18, 0x1C, 0x20, 
+  0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x1C, 0x15, 0x15, 0x32, 0x32, 0x32, 0x1F, 0x2C, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x15, 0x1C, 0x15, 0x11, 0x25, 0x49, 0x60, 0x49, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2C, 
+  0x40, 0x40, 0x25, 0x1F, 0x60, 0x6C, 0x60, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0x49, 0x49, 0x32, 
+  0x00, 0x5B, 0x65, 0x49, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1D, 0x32, 0x32, 0x1F, 0x00, 0x40, 0x5B, 
+  0x2C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x32, 0x2C, 0x1D, 0x00, 0x3A, 0x57, 0x1D, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x3A, 0x57, 0x1F, 0x00, 0x3A, 0x3A, 0x2C, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x40, 0x49, 0x1F, 0x00, 0x1F, 0x17, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x17, 0x1B, 
+  0x17, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x17, 0x17, 0x17, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x65, 0x65, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 
+  0x6C, 0x6E, 0x68, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3B, 0x4A, 0x57, 0x65, 0x53, 
+  0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2B, 0x1E, 0x1E, 0x22, 0x2A, 0x31, 0x31, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x2D, 0x49, 0x49, 0x4E, 0x49, 0x2D, 0x37, 0x2D, 0x24, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x34, 0x37, 0x37, 0x34, 0x37, 0x3C, 0x3C, 0x37, 0x37, 0x37, 0x27, 0x20, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x1C, 0x27, 0x2D, 0x34, 
+  0x34, 0x2D, 0x2D, 0x34, 0x37, 0x2D, 0x1C, 0x18, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x13, 0x15, 0x18, 0x1C, 0x27, 0x27, 0x27, 0x27, 
+  0x27, 0x27, 0x27, 0x15, 0x23, 0x51, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x23, 0x55, 0x2E, 0x18, 0x27, 0x27, 0x27, 0x27, 0x27, 0x24, 0x20, 
+  0x13, 0x1A, 0x38, 0x2B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x1A, 0x2E, 0x1A, 0x0D, 0x1C, 0x20, 0x15, 0x15, 0x1C, 0x20, 0x18, 0x13, 0x16, 0x23, 
+  0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2C, 
+  0x3A, 0x1F, 0x25, 0x0D, 0x25, 0x39, 0x3E, 0x39, 0x22, 0x11, 0x13, 0x1D, 0x3D, 0x40, 0x32, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x25, 0x40, 
+  0x3A, 0x57, 0x57, 0x49, 0x49, 0x53, 0x40, 0x3A, 0x0F, 0x1F, 0x1D, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x15, 0x24, 0x27, 
+  0x18, 0x18, 0x24, 0x27, 0x1C, 0x21, 0x23, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x18, 0x20, 0x1C, 0x11, 0x11, 0x15, 
+  0x15, 0x18, 0x11, 0x14, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x20, 0x11, 0x11, 0x0D, 0x0D, 0x0B, 0x0D, 0x0D, 0x15, 0x0D, 
+  0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x20, 0x24, 0x1C, 0x18, 0x18, 0x18, 0x0D, 0x11, 0x11, 0x18, 0x0D, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 
+  0x1C, 0x1C, 0x1C, 0x1C, 0x18, 0x0D, 0x11, 0x11, 0x18, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x1C, 0x20, 
+  0x1C, 0x11, 0x0B, 0x0D, 0x15, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x20, 0x24, 0x1C, 0x15, 0x11, 
+  0x18, 0x15, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0x40, 0x49, 0x40, 0x1D, 0x1D, 0x1D, 0x19, 0x0D, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x32, 0x60, 0x6C, 0x60, 0x2C, 0x1F, 0x32, 0x2C, 0x25, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x2C, 0x49, 0x60, 0x49, 0x1F, 0x25, 0x32, 0x32, 0x1D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3A, 
+  0x65, 0x3A, 0x00, 0x1F, 0x25, 0x25, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2C, 0x57, 0x32, 0x00, 
+  0x1D, 0x1F, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x32, 0x32, 0x25, 0x00, 0x25, 0x3A, 0x25, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x1E, 0x1B, 0x00, 0x25, 0x2C, 0x2C, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x14, 0x17, 0x17, 0x00, 0x1B, 0x17, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x14, 0x14, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x65, 0x68, 0x60, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x65, 0x6C, 0x6C, 0x6C, 0x65, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x57, 0x5B, 0x5B, 0x68, 0x65, 0x53, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 
+  0x3B, 0x39, 0x39, 0x3E, 0x30, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2D, 0x3C, 0x34, 0x37, 0x5A, 
+  0x37, 0x34, 0x34, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2D, 0x3C, 0x3C, 0x43, 0x43, 0x43, 0x3C, 0x43, 0x3C, 
+  0x3C, 0x34, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x24, 0x34, 0x37, 0x34, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x37, 0x27, 0x20, 0x15, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x12, 0x12, 0x00, 
+  0x3D, 0x4F, 0x1D, 0x34, 0x37, 0x37, 0x37, 0x37, 0x34, 0x34, 0x24, 0x21, 0x51, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x0C, 0x23, 0x63, 0x55, 0x21, 
+  0x27, 0x34, 0x37, 0x3C, 0x37, 0x34, 0x2D, 0x1C, 0x23, 0x47, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x57, 0x60, 0x35, 0x1A, 0x1C, 0x18, 0x15, 
+  0x17, 0x1D, 0x1C, 0x20, 0x15, 0x21, 0x35, 0x29, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2C, 0x2C, 0x36, 0x19, 0x11, 0x32, 0x4B, 0x65, 0x54, 0x49, 
+  0x25, 0x1F, 0x36, 0x4A, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x1D, 0x00, 0x53, 0x32, 0x49, 0x49, 0x40, 0x40, 0x40, 0x60, 0x49, 0x17, 
+  0x2C, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x5B, 0x18, 0x24, 0x2D, 0x20, 0x1C, 0x27, 0x2D, 0x20, 0x23, 0x23, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x1C, 0x18, 0x27, 0x24, 0x15, 0x15, 0x15, 0x18, 0x1C, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 
+  0x11, 0x0D, 0x0D, 0x11, 0x18, 0x18, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x20, 0x1C, 0x1C, 0x18, 0x15, 0x15, 
+  0x20, 0x18, 0x20, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x20, 0x1C, 0x1C, 0x15, 0x15, 0x18, 0x1C, 0x27, 
+  0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x15, 0x18, 0x1C, 0x18, 0x11, 0x11, 0x18, 0x20, 0x20, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x1C, 0x27, 0x27, 0x20, 0x25, 0x1F, 0x24, 0x20, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x49, 
+  0x5B, 0x3A, 0x2C, 0x32, 0x3A, 0x2C, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2C, 0x60, 0x68, 0x65, 0x32, 
+  0x3A, 0x5B, 0x5B, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5B, 0x6C, 0x65, 0x2C, 0x57, 0x65, 0x60, 
+  0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3A, 0x68, 0x57, 0x00, 0x3A, 0x57, 0x49, 0x25, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x2C, 0x65, 0x40, 0x00, 0x32, 0x49, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x32, 0x40, 0x3A, 0x00, 0x32, 0x49, 0x2C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0x17, 0x17, 
+  0x00, 0x40, 0x68, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x17, 0x1D, 0x1E, 0x2A, 
+  0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x14, 0x14, 0x14, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x68, 0x6C, 0x68, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x57, 0x6C, 0x6E, 0x6E, 0x65, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x36, 0x36, 0x4D, 0x57, 0x41, 0x41, 0x36, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x3B, 
+  0x39, 0x42, 0x31, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2D, 0x3A, 0x49, 0x49, 0x34, 0x34, 
+  0x34, 0x2D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x27, 0x27, 0x34, 0x34, 0x37, 0x2D, 0x37, 0x37, 0x2D, 0x20, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x1C, 0x1C, 0x20, 0x20, 0x24, 0x27, 0x2D, 0x18, 0x1D, 0x3D, 0x48, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 
+  0x1C, 0x1C, 0x20, 0x1C, 0x24, 0x20, 0x14, 0x6B, 0x74, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x1C, 0x1C, 0x20, 
+  0x1C, 0x1C, 0x18, 0x14, 0x23, 0x38, 0x51, 0x4C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x18, 0x1D, 0x18, 0x1C, 0x1C, 0x15, 
+  0x0D, 0x13, 0x1A, 0x48, 0x56, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5B, 0x28, 0x49, 0x4B, 0x4D, 0x41, 0x1F, 0x19, 0x13, 0x19, 
+  0x32, 0x3A, 0x1D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x3A, 0x32, 0x40, 0x32, 0x32, 0x40, 0x49, 0x32, 0x14, 0x14, 0x1D, 0x2B, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x15, 0x18, 0x1C, 0x15, 0x18, 0x20, 0x24, 0x1C, 0x11, 0x14, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x15, 
+  0x0D, 0x11, 0x15, 0x18, 0x18, 0x24, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x0D, 0x0B, 0x0B, 0x15, 
+  0x1C, 0x20, 0x1C, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x0D, 0x15, 0x18, 0x18, 0x27, 0x18, 
+  0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x15, 0x15, 0x11, 0x0D, 0x15, 0x18, 0x20, 0x20, 0x11, 0x1D, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x11, 0x15, 0x11, 0x0D, 0x15, 0x1C, 0x18, 0x15, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 
+  0x19, 0x13, 0x0B, 0x25, 0x3A, 0x2C, 0x1D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1D, 0x1D, 0x1D, 0x1F, 
+  0x3A, 0x49, 0x3A, 0x1F, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2C, 0x25, 0x1F, 0x3A, 0x49, 0x49, 0x3A, 
+  0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0x1F, 0x1D, 0x25, 0x3A, 0x3A, 0x25, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x1D, 0x1F, 0x14, 0x00, 0x32, 0x2C, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x32, 0x32, 0x17, 0x32, 0x3A, 0x32, 0x2C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x22, 0x17, 
+  0x32, 0x57, 0x32, 0x2C, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x26, 0x22, 
+  0x1E, 0x17, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x7C, 
+  0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0x6C, 0x6E, 0x6E, 0x65, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x71, 0x36, 0x4D, 0x57, 0x41, 0x41, 0x5C, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x22, 0x3B, 0x39, 0x42, 0x31, 0x29, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x70, 0x40, 0x2D, 0x49, 0x34, 0x34, 0x2D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6A, 0x2D, 0x34, 0x37, 
+  0x2D, 0x34, 0x3C, 0x34, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6A, 0x20, 0x20, 0x24, 0x27, 0x24, 0x1F, 0x1D, 
+  0x4F, 0x35, 0x5C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x47, 0x1C, 0x20, 0x1C, 0x20, 0x27, 0x19, 0x36, 0x74, 0x67, 0x71, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x50, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x15, 0x14, 0x38, 0x51, 0x5C, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5C, 
+  0x18, 0x1F, 0x1C, 0x1C, 0x18, 0x11, 0x0D, 0x13, 0x3F, 0x56, 0x77, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5B, 0x28, 0x49, 0x49, 
+  0x4A, 0x3A, 0x1F, 0x13, 0x13, 0x25, 0x3A, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3A, 0x32, 0x3A, 0x2C, 0x3A, 0x49, 0x40, 
+  0x2C, 0x14, 0x17, 0x1D, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x1C, 0x18, 0x15, 0x20, 0x24, 0x24, 0x18, 0x11, 0x14, 
+  0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x2C, 0x18, 0x11, 0x0D, 0x11, 0x15, 0x18, 0x20, 0x24, 0x11, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x38, 0x11, 0x0D, 0x0B, 0x0D, 0x18, 0x1C, 0x20, 0x1C, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x11, 0x11, 
+  0x0D, 0x15, 0x18, 0x18, 0x27, 0x18, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2E, 0x15, 0x11, 0x0D, 0x11, 0x18, 
+  0x20, 0x20, 0x11, 0x1D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2E, 0x15, 0x11, 0x0D, 0x11, 0x15, 0x18, 0x18, 0x15, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0x19, 0x13, 0x52, 0x15, 0x18, 0x18, 0x15, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x29, 0x1D, 0x1D, 0x44, 0x3A, 0x49, 0x3A, 0x1D, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 
+  0x25, 0x2E, 0x3A, 0x49, 0x49, 0x32, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x1F, 0x38, 0x25, 
+  0x3A, 0x3A, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1D, 0x1F, 0x14, 0x40, 0x40, 0x2C, 0x19, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x47, 0x32, 0x17, 0x25, 0x3A, 0x32, 0x2C, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x22, 0x22, 0x17, 0x2A, 0x32, 0x3A, 0x32, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x12, 0x12, 0x12, 0x12, 0x14, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 
+};
+
+static const u8 g_player_spritesheet_mip2[PLAYER_NTILES * 15 * 15] = {
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x53, 0x40, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x40, 0x46, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x34, 0x20, 0x1F, 0x1F, 0x2D, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x27, 
+  0x27, 0x24, 0x20, 0x18, 0x25, 0x30, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0x5F, 0x11, 
+  0x11, 0x1B, 0x1E, 0x2F, 0x3D, 0x4C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0x68, 0x1E, 0x1B, 
+  0x14, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x16, 0x2B, 0x19, 
+  0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0x15, 0x0D, 0x15, 0x15, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x18, 0x18, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x32, 0x25, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x25, 0x25, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x32, 0x32, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x4D, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2C, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x40, 0x4D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x49, 0x4E, 0x4D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x34, 0x1F, 0x1D, 0x1F, 0x34, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x24, 0x24, 0x2D, 0x18, 0x1C, 0x25, 0x30, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x72, 
+  0x23, 0x11, 0x25, 0x1B, 0x12, 0x2B, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x56, 0x1B, 
+  0x1B, 0x14, 0x12, 0x1F, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x0F, 0x1F, 
+  0x19, 0x1D, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x1C, 0x0D, 
+  0x15, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x15, 0x11, 0x11, 
+  0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0x11, 0x11, 0x15, 0x11, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1D, 0x13, 0x1D, 0x1D, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x1D, 0x19, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1D, 0x19, 0x32, 0x3A, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0x25, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4D, 0x49, 0x4A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x4A, 0x49, 0x4D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x2D, 0x2D, 0x1D, 0x1D, 0x20, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x32, 0x1C, 0x24, 0x18, 0x18, 0x32, 0x22, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 
+  0x48, 0x12, 0x1F, 0x1E, 0x17, 0x17, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x36, 
+  0x17, 0x17, 0x14, 0x1D, 0x1F, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x12, 0x23, 
+  0x14, 0x19, 0x1D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x18, 0x15, 
+  0x19, 0x11, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x0D, 
+  0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0x2C, 0x0D, 0x0D, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1D, 0x1F, 0x19, 0x1D, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0x2C, 0x19, 0x1F, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x1F, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x57, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x49, 0x46, 0x4D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x37, 0x2D, 0x2C, 0x3B, 0x32, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x32, 0x20, 0x27, 0x27, 0x18, 0x27, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x6B, 0x6F, 0x11, 0x15, 0x15, 0x19, 0x2F, 0x28, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x45, 
+  0x5F, 0x19, 0x1D, 0x17, 0x14, 0x0F, 0x2B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x14, 
+  0x12, 0x12, 0x19, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x1C, 
+  0x1D, 0x1C, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x18, 0x15, 
+  0x15, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x15, 0x15, 0x15, 
+  0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x1D, 0x1F, 0x1F, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x1D, 0x19, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3A, 0x1D, 0x13, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x49, 0x57, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4A, 0x4B, 0x4D, 0x4D, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0x1F, 0x25, 0x34, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x1C, 0x18, 0x1C, 0x27, 0x2D, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x1D, 0x15, 0x1C, 0x18, 0x74, 0x5D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x23, 0x17, 0x35, 0x67, 0x3D, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x23, 0x23, 0x2F, 0x19, 0x13, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x0D, 0x13, 0x13, 0x0D, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x11, 0x11, 0x0B, 0x15, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 
+  0x11, 0x0B, 0x32, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1D, 
+  0x13, 0x25, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x13, 
+  0x2C, 0x2C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x13, 0x2C, 
+  0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x32, 0x25, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6B, 0x5B, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4A, 0x53, 0x4D, 0x4D, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x50, 0x32, 0x34, 0x27, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x47, 0x5C, 0x70, 0x70, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x6A, 0x3D, 0x70, 0x47, 0x04, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x75, 0x51, 0x47, 0x6A, 0x3F, 0x1D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x23, 0x23, 0x2E, 0x19, 0x13, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x0D, 0x13, 0x13, 0x0D, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x11, 0x11, 0x0D, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x15, 0x11, 0x0D, 0x3D, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x1D, 0x13, 0x47, 0x2C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 
+  0x13, 0x1F, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x13, 
+  0x3D, 0x4C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x51, 
+  0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5B, 0x68, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x45, 0x39, 0x42, 0x5B, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3B, 0x4A, 0x3A, 0x40, 0x37, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x15, 0x24, 0x2D, 0x1D, 0x11, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0x1D, 0x1B, 0x22, 0x2F, 0x47, 0x6F, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x1B, 0x17, 0x14, 0x17, 0x2F, 0x2B, 0x36, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x0F, 0x0F, 0x0F, 0x17, 0x1D, 0x25, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x21, 0x0D, 0x15, 0x18, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x0D, 0x18, 0x1C, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x2C, 0x18, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x32, 0x32, 0x1F, 0x2C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x32, 0x32, 0x00, 0x2C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x49, 0x2C, 0x00, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x32, 
+  0x2C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4A, 0x60, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x39, 0x4B, 0x53, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0x2C, 0x3A, 0x14, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x11, 0x2C, 0x1B, 0x1C, 0x20, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x1B, 0x17, 0x4C, 0x4C, 0x56, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x17, 0x17, 0x19, 0x25, 0x19, 0x1D, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x0F, 0x14, 0x12, 0x19, 0x19, 0x19, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x23, 0x11, 0x11, 0x15, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x15, 0x11, 0x1C, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x15, 0x1C, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x1F, 0x2C, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x1F, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x49, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x3A, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x45, 0x60, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x39, 0x57, 0x5B, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3B, 0x2A, 0x40, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x18, 0x19, 0x24, 0x20, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x17, 0x17, 0x35, 0x1D, 0x63, 0x48, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x17, 0x17, 0x12, 0x23, 0x2B, 0x3F, 0x2F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x14, 0x14, 0x0F, 0x19, 0x2B, 0x1D, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x18, 0x19, 0x11, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x15, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x1F, 0x11, 0x0D, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x1F, 0x1D, 0x00, 0x1D, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x25, 0x25, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x3A, 0x2C, 0x00, 0x00, 0x32, 0x2C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 
+  0x32, 0x2C, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4D, 0x65, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x42, 0x57, 0x57, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2C, 0x3B, 0x32, 0x2D, 0x37, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x18, 0x24, 0x2D, 0x24, 0x1C, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x23, 0x17, 0x2C, 0x17, 0x35, 0x6B, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0x1B, 0x12, 0x12, 0x23, 0x4C, 0x51, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x12, 0x12, 0x12, 0x1D, 0x25, 0x13, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x18, 0x15, 0x1C, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x18, 0x15, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0x15, 0x15, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x25, 0x1D, 0x1D, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x1F, 0x19, 0x1F, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x2C, 0x19, 0x25, 0x2C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x68, 0x68, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x39, 0x5B, 0x57, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3B, 
+  0x32, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x27, 
+  0x37, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x63, 0x38, 
+  0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x12, 0x1B, 0x1B, 0x1E, 0x3B, 0x45, 0x31, 0x12, 0x19, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2B, 0x3F, 0x23, 0x19, 0x13, 0x1D, 0x25, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x24, 0x1C, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x20, 0x15, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x32, 0x1D, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x32, 0x1F, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0x2C, 0x19, 0x1D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x3A, 0x3A, 0x2C, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x65, 0x68, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x41, 0x5B, 0x6B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x5D, 0x3D, 0x49, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x56, 0x37, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6A, 0x72, 
+  0x38, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x29, 0x50, 0x1B, 0x1B, 0x35, 0x5C, 0x31, 0x14, 
+  0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x50, 0x21, 0x19, 0x19, 0x25, 
+  0x1D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x27, 0x20, 0x11, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x48, 0x15, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6A, 0x1C, 0x0D, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x1F, 0x13, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x51, 0x25, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x1D, 0x19, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x4A, 0x2C, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x68, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x68, 
+  0x57, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x45, 0x32, 0x27, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1D, 0x20, 0x34, 0x34, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x10, 0x18, 0x18, 0x4F, 0x56, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x38, 0x47, 0x5D, 0x5D, 0x49, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x1A, 0x38, 0x1D, 0x13, 0x0D, 0x1C, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x1A, 0x00, 0x11, 0x18, 0x15, 0x15, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x1C, 0x15, 0x18, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x15, 0x11, 0x1C, 0x20, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x32, 0x25, 0x00, 0x1D, 0x40, 0x5B, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x3A, 0x32, 0x00, 0x00, 0x00, 0x3A, 0x57, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x32, 0x00, 0x00, 0x00, 0x00, 0x32, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x3A, 0x40, 0x32, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x60, 0x6C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x4D, 0x53, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x36, 0x36, 
+  0x24, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x1C, 0x20, 
+  0x49, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x55, 0x4F, 0x5F, 0x68, 
+  0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x0F, 0x38, 0x2B, 0x23, 0x1D, 0x19, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x3F, 0x2E, 0x19, 0x13, 0x15, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x18, 0x11, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x15, 0x11, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x1C, 0x0D, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2C, 0x32, 0x1F, 0x40, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2C, 0x00, 0x25, 0x3A, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x57, 0x3A, 0x00, 0x3A, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x40, 0x40, 0x2A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x68, 0x68, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x28, 0x5B, 0x65, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x45, 
+  0x2C, 0x24, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 
+  0x34, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x36, 0x00, 0x1D, 0x4F, 
+  0x47, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x38, 0x51, 0x55, 0x45, 0x32, 
+  0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x14, 0x38, 0x19, 0x12, 0x14, 0x25, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x11, 0x18, 0x15, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x18, 0x18, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x11, 0x11, 0x15, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1D, 0x19, 0x19, 0x1D, 0x3A, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0x1F, 0x00, 0x00, 0x1D, 0x2C, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x2C, 0x00, 0x00, 0x00, 0x3A, 0x2C, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x2A, 0x2C, 0x28, 0x00, 0x00, 0x32, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x60, 0x6C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x30, 0x60, 0x57, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x4A, 0x32, 0x49, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x15, 0x20, 0x37, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x01, 0x19, 
+  0x15, 0x48, 0x6B, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x31, 0x5D, 0x63, 
+  0x6B, 0x49, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x23, 0x29, 0x23, 0x13, 
+  0x13, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x11, 0x18, 
+  0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x18, 0x20, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x18, 0x18, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0x1F, 0x25, 0x40, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x1F, 0x2C, 0x40, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x2C, 0x40, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x1D, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x6C, 0x57, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x41, 0x41, 0x36, 0x36, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x24, 0x37, 0x34, 0x27, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x32, 0x18, 0x1C, 0x1C, 0x18, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x14, 0x2A, 0x17, 0x1E, 
+  0x41, 0x21, 0x13, 0x15, 0x18, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x14, 0x2E, 0x19, 
+  0x1A, 0x25, 0x32, 0x32, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x1C, 0x18, 0x1C, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x20, 
+  0x15, 0x0D, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x11, 0x11, 
+  0x0D, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2C, 0x11, 0x00, 0x17, 
+  0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x32, 0x1F, 0x00, 0x00, 0x25, 
+  0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x25, 0x00, 0x00, 0x00, 0x25, 0x32, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x32, 0x32, 0x25, 0x00, 0x00, 0x00, 0x1E, 0x26, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x65, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0x6E, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x3B, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x70, 0x37, 0x2D, 0x24, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x6A, 0x48, 0x18, 0x20, 0x1C, 0x18, 0x00, 0x00, 0x00, 0x00, 0x70, 0x1A, 0x50, 0x22, 
+  0x1B, 0x5C, 0x16, 0x0D, 0x18, 0x18, 0x11, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x2E, 
+  0x29, 0x1A, 0x2C, 0x32, 0x3A, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 
+  0x00, 0x20, 0x15, 0x1C, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 
+  0x1C, 0x15, 0x0D, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x11, 
+  0x11, 0x0D, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x11, 0x00, 
+  0x23, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x1F, 0x00, 0x00, 
+  0x25, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x25, 0x00, 0x00, 0x00, 0x35, 
+  0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x32, 0x25, 0x00, 0x00, 0x00, 0x1E, 0x17, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6C, 0x65, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x3B, 0x32, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x1C, 0x37, 0x2D, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 
+  0x00, 0x00, 0x4C, 0x5D, 0x25, 0x20, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x51, 
+  0x55, 0x56, 0x53, 0x18, 0x1C, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 
+  0x21, 0x17, 0x3A, 0x40, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x13, 
+  0x1C, 0x18, 0x15, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 
+  0x1C, 0x11, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x15, 
+  0x18, 0x24, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3A, 0x32, 0x00, 0x00, 
+  0x32, 0x68, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2C, 0x40, 0x2C, 0x00, 0x00, 
+  0x40, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x32, 0x00, 0x00, 0x00, 0x00, 
+  0x45, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x32, 0x32, 0x00, 0x00, 0x00, 0x00, 0x1B, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6C, 0x5B, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x57, 0x53, 0x4D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x34, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x12, 0x00, 0x00, 0x27, 0x27, 0x20, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x48, 0x3D, 0x5F, 0x5F, 0x23, 0x20, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x35, 0x2B, 0x25, 0x2C, 0x32, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x12, 0x12, 0x1F, 0x20, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x18, 0x1C, 0x18, 0x0D, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x1C, 0x18, 0x18, 0x0D, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 
+  0x1C, 0x11, 0x25, 0x2C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3A, 
+  0x2C, 0x25, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2C, 0x25, 
+  0x00, 0x32, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x32, 0x32, 0x00, 
+  0x2C, 0x2C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2C, 0x25, 0x1B, 0x00, 0x1E, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6C, 0x68, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x45, 0x4D, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x37, 0x34, 0x2D, 0x24, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x0A, 0x0F, 0x00, 0x00, 0x2C, 0x32, 0x24, 0x24, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x36, 0x51, 0x48, 0x53, 0x23, 0x1C, 0x1C, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x1A, 0x12, 0x25, 0x3A, 0x40, 0x2C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x12, 0x0F, 0x15, 0x18, 0x20, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x1C, 0x20, 0x15, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x15, 0x1C, 0x18, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x1C, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x25, 0x3A, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x19, 0x1D, 0x3A, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0x19, 
+  0x19, 0x2C, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6C, 0x6C, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5B, 0x5B, 0x5B, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0x2D, 0x37, 0x34, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x34, 0x27, 0x34, 0x24, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x0A, 0x12, 0x22, 0x00, 0x63, 0x67, 0x2C, 0x27, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x55, 0x51, 0x3B, 0x2C, 0x32, 0x40, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x0C, 0x0F, 0x11, 0x27, 0x2D, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x25, 0x1C, 0x18, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x18, 0x20, 0x18, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x18, 0x24, 0x2C, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x32, 0x65, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x32, 0x57, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x32, 0x40, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x1F, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6C, 0x6C, 0x5B, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x2C, 0x3A, 0x2A, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0x37, 0x34, 0x34, 0x2D, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x1C, 0x27, 0x24, 0x20, 0x18, 0x3F, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x1D, 0x1A, 0x13, 0x1C, 0x1C, 0x18, 0x11, 0x1A, 0x35, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x1D, 0x1F, 0x32, 0x40, 0x32, 0x1D, 0x19, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x1C, 0x18, 0x1C, 0x11, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x18, 0x11, 0x0D, 0x11, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x11, 0x11, 0x00, 0x11, 0x1C, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x32, 
+  0x15, 0x0D, 0x00, 0x00, 0x3A, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2C, 0x2C, 
+  0x00, 0x00, 0x00, 0x32, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x32, 0x25, 0x00, 
+  0x00, 0x00, 0x00, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2C, 0x32, 0x00, 0x00, 
+  0x00, 0x00, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x76, 0x68, 0x68, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x33, 0x33, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0x37, 0x37, 0x34, 0x34, 0x27, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4C, 0x1C, 0x27, 0x24, 0x24, 0x20, 0x1D, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x75, 0x3F, 0x50, 0x13, 0x1C, 0x1C, 0x18, 0x18, 0x16, 0x23, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x50, 0x35, 0x32, 0x40, 0x3A, 0x2C, 0x16, 0x1F, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x20, 0x18, 0x1C, 0x11, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x3D, 0x15, 0x0D, 0x0D, 0x15, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x2E, 0x11, 0x0D, 0x0D, 0x1C, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x1F, 0x11, 0x00, 0x00, 0x2C, 0x2C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x51, 
+  0x2C, 0x1D, 0x00, 0x00, 0x25, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5C, 0x25, 
+  0x00, 0x00, 0x00, 0x00, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x36, 0x32, 0x00, 
+  0x00, 0x00, 0x00, 0x2B, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x65, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0x53, 0x36, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 0x2D, 0x2D, 0x27, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x48, 0x20, 0x34, 0x2D, 0x27, 0x20, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0x48, 0x1D, 0x20, 0x1C, 0x1C, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x32, 0x40, 0x49, 0x3A, 0x2C, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x18, 0x20, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x1C, 0x2D, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x1C, 0x27, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x1C, 0x18, 0x57, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x32, 0x3A, 0x57, 0x57, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x3A, 0x26, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x3A, 0x17, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x65, 
+  0x65, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4A, 0x4D, 0x41, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0x37, 0x3C, 0x34, 0x2D, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x25, 0x27, 0x2D, 0x34, 0x2D, 0x27, 0x18, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x56, 0x2E, 0x1C, 0x24, 0x20, 0x1C, 0x21, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2C, 0x25, 0x2C, 0x40, 0x40, 0x1F, 0x1D, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x18, 0x1C, 0x24, 0x1D, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x18, 0x0D, 0x15, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x11, 0x1C, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x15, 0x40, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x49, 0x2C, 0x65, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x32, 0x00, 0x49, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x40, 0x00, 0x2C, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x68, 
+  0x6C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3B, 0x4A, 
+  0x36, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 0x34, 0x37, 0x37, 
+  0x2D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x1C, 0x27, 0x2D, 0x2D, 0x2D, 0x18, 
+  0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x18, 0x20, 0x20, 0x20, 0x13, 0x2E, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2C, 0x2C, 0x40, 0x42, 0x2C, 0x1D, 0x2C, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x20, 0x15, 0x1C, 0x1F, 0x1A, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x15, 0x0D, 0x11, 0x15, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x1C, 0x11, 0x11, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x3A, 0x11, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x49, 0x60, 0x25, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x32, 0x49, 0x00, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x22, 0x00, 0x2C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x6C, 0x68, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4A, 
+  0x57, 0x53, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 0x3C, 0x3C, 
+  0x3C, 0x37, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x27, 0x37, 0x3C, 0x37, 
+  0x2D, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0x38, 0x24, 0x24, 0x24, 0x20, 
+  0x2E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0x2C, 0x2C, 0x49, 0x49, 0x3A, 0x2C, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3A, 0x20, 0x20, 0x1C, 0x20, 0x23, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x15, 0x15, 0x1C, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x1C, 0x18, 0x15, 0x20, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x32, 0x32, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x65, 0x53, 0x57, 0x53, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x57, 0x40, 0x40, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x26, 0x26, 0x49, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x17, 0x1E, 0x1D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x6C, 0x68, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x36, 0x4A, 
+  0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x2D, 0x34, 0x34, 
+  0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x20, 0x24, 0x18, 0x63, 
+  0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x1C, 0x15, 0x21, 0x55, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3A, 0x40, 0x3A, 0x2C, 0x14, 0x2C, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x15, 0x18, 0x1C, 0x15, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x0D, 0x15, 0x20, 0x1C, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x11, 0x18, 0x1C, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x19, 0x25, 0x3A, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x25, 0x1F, 0x3A, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x1F, 0x32, 0x2C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x3A, 0x2C, 0x1B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x6E, 0x6C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 
+  0x4A, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2D, 0x34, 
+  0x37, 0x2D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x20, 0x24, 0x1F, 
+  0x5D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x1C, 0x1C, 0x11, 0x38, 
+  0x5D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3A, 0x40, 0x40, 0x25, 0x19, 0x3D, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x11, 0x18, 0x1C, 0x15, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x0D, 0x15, 0x20, 0x1C, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x11, 0x15, 0x1C, 0x15, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0x19, 0x35, 0x32, 0x1D, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x2E, 0x3A, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x32, 0x2C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x25, 0x1D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+};
+
+static const u8 g_player_spritesheet_mip3[PLAYER_NTILES * 8 * 8] = {
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3A, 0x3A, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x56, 0x18, 0x25, 0x25, 0x00, 0x00, 0x00, 0x00, 0x41, 0x17, 0x19, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x11, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x2C, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3A, 0x32, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x56, 0x1C, 0x25, 0x25, 0x00, 0x00, 0x00, 0x00, 0x36, 0x17, 0x19, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x15, 0x11, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x19, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x1D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x32, 0x32, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x48, 0x18, 0x1F, 0x25, 0x00, 0x00, 0x00, 0x00, 0x1B, 0x17, 0x19, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x15, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0x19, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x32, 0x1D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x3A, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x56, 0x1C, 0x18, 0x2C, 0x00, 0x00, 0x00, 0x00, 0x3B, 0x14, 0x19, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1D, 0x1D, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x25, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x57, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x32, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x18, 0x1C, 0x56, 0x00, 0x00, 0x00, 0x00, 0x00, 0x23, 0x3D, 0x1D, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x0D, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x25, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x19, 0x2C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x6B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x47, 0x6A, 0x56, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4C, 0x47, 0x23, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x0D, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0x3D, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x19, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4C, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x39, 0x49, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x18, 0x25, 0x2C, 0x48, 0x00, 0x00, 0x00, 0x00, 0x14, 0x17, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x11, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2C, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x40, 0x2C, 0x2C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3A, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3A, 0x32, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x18, 0x1D, 0x36, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x14, 0x19, 0x1D, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x11, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1D, 0x25, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3A, 0x49, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x19, 0x1F, 0x2C, 0x00, 0x00, 0x00, 0x00, 0x14, 0x14, 0x19, 0x2B, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x15, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1D, 0x11, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x2C, 0x00, 0x2C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x32, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x49, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x1D, 0x18, 0x2C, 0x4F, 0x00, 0x00, 0x00, 0x00, 0x17, 0x14, 0x2B, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x18, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x1D, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x25, 0x1D, 0x2C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x32, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x49, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x3A, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x1B, 0x2F, 0x2F, 0x1D, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x15, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2C, 0x1D, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x32, 0x1D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x32, 0x1E, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0x56, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x6A, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x38, 0x38, 0x2E, 0x19, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x18, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x55, 0x1D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x32, 0x22, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4D, 0x49, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x18, 0x49, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x3D, 0x25, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x18, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2C, 0x15, 0x2C, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x3A, 0x00, 0x00, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0x40, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x1B, 0x3D, 0x56, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x35, 0x19, 0x11, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2C, 0x25, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x32, 0x2C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3A, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x45, 0x40, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x17, 0x18, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x3F, 0x1F, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x25, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x32, 0x00, 0x00, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3A, 0x49, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x20, 0x40, 0x00, 0x00, 0x00, 0x00, 0x12, 0x35, 0x3D, 0x2C, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x15, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x2C, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x24, 0x20, 0x00, 0x00, 0x00, 0x00, 0x1B, 0x1D, 0x1F, 0x25, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x1C, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x11, 0x19, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x32, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x00, 0x32, 0x2C, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x56, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x6A, 0x24, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x1B, 0x29, 0x25, 0x25, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x18, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4C, 0x11, 0x19, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x51, 0x00, 0x35, 0x2C, 0x00, 0x00, 0x00, 0x48, 0x2C, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x57, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x27, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x36, 0x2C, 0x20, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x1C, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x1C, 0x49, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x32, 0x00, 0x4D, 0x00, 0x00, 0x00, 0x00, 0x32, 0x2C, 0x00, 0x1E, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x49, 0x40, 0x00, 0x00, 0x00, 
+  0x00, 0x2B, 0x48, 0x3A, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1D, 0x1F, 0x1C, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x18, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x1F, 0x40, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x27, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x3B, 0x32, 0x20, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x32, 0x18, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x32, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x19, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x49, 0x49, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x56, 0x27, 0x20, 0x00, 0x00, 0x00, 0x00, 0x47, 0x1F, 0x24, 0x32, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x15, 0x1C, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x57, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x24, 0x2D, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x32, 0x1F, 0x23, 0x00, 0x00, 
+  0x00, 0x00, 0x18, 0x15, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x18, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x2C, 0x00, 0x00, 0x32, 0x00, 0x00, 0x00, 0x00, 0x32, 0x00, 0x00, 0x2C, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x56, 0x53, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x27, 0x2D, 0x27, 0x2C, 0x00, 0x00, 0x00, 0x00, 0x2E, 0x32, 0x25, 0x1A, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x15, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x11, 0x18, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x3D, 0x00, 0x00, 0x32, 0x00, 0x00, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x1F, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0x4D, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x2D, 0x2D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3B, 0x32, 0x20, 0x25, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x18, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x40, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x32, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x49, 0x40, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x48, 0x27, 0x24, 0x1D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2C, 0x32, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x15, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2C, 0x40, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x32, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x49, 0x27, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x1C, 0x27, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0x32, 0x25, 0x1F, 0x00, 0x00, 
+  0x00, 0x00, 0x1C, 0x15, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x32, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x2C, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x49, 0x49, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x32, 0x2D, 0x2D, 0x2E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x32, 0x32, 0x2F, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x49, 0x3A, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x3A, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x57, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x24, 0x27, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x32, 0x25, 0x2F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x11, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x1C, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x25, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x32, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x24, 0x27, 0x4F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x32, 0x25, 0x38, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x15, 0x1C, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x18, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x35, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0x00, 0x00, 0x00, 0x00, 
+  
+};
+
+static const u32 g_player_mip_w[MIP_LEVELS] = { 57, 29, 15, 8 };
+static const u32 g_player_mip_h[MIP_LEVELS] = { 59, 30, 15, 8 };
+static const u8* const g_player_mips[MIP_LEVELS] = {
+  g_player_spritesheet,
+  g_player_spritesheet_mip1,
+  g_player_spritesheet_mip2,
+  g_player_spritesheet_mip3,
+};
+
+static const u16 g_player_span_index_mip0[1711] = {
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0001, 0x0002, 0x0003, 
+  0x0004, 0x0005, 0x0006, 0x0007, 0x0009, 0x000B, 0x000C, 0x000D, 0x000E, 0x0010, 0x0011, 0x0012, 
+  0x0013, 0x0014, 0x0015, 0x0016, 0x0017, 0x0018, 0x001A, 0x001C, 0x001E, 0x0020, 0x0021, 0x0022, 
+  0x0023, 0x0024, 0x0025, 0x0026, 0x0027, 0x0028, 0x0029, 0x002A, 0x002B, 0x002C, 0x002D, 0x002E, 
+  0x002F, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 
+  0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0031, 0x0032, 0x0033, 0x0034, 
+  0x0035, 0x0036, 0x0037, 0x003A, 0x003C, 0x003E, 0x003F, 0x0040, 0x0042, 0x0043, 0x0044, 0x0045, 
+  0x0046, 0x0048, 0x0049, 0x004B, 0x004C, 0x004E, 0x0050, 0x0051, 0x0055, 0x0057, 0x0059, 0x005A, 
+  0x005B, 0x005C, 0x005D, 0x005E, 0x0060, 0x0061, 0x0062, 0x0063, 0x0064, 0x0064, 0x0064, 0x0064, 
+  0x0064, 0x0064, 0x0064, 0x0064, 0x0064, 0x0064, 0x0064, 0x0064, 0x0064, 0x0064, 0x0064, 0x0064, 
+  0x0064, 0x0064, 0x0064, 0x0064, 0x0065, 0x0066, 0x0067, 0x0068, 0x0069, 0x006A, 0x006C, 0x006D, 
+  0x006E, 0x0071, 0x0072, 0x0073, 0x0074, 0x0075, 0x0077, 0x007A, 0x007B, 0x007C, 0x007D, 0x007E, 
+  0x007F, 0x0080, 0x0082, 0x0085, 0x0087, 0x0088, 0x0089, 0x008A, 0x008B, 0x008C, 0x008D, 0x008F, 
+  0x0090, 0x0091, 0x0092, 0x0093, 0x0094, 0x0095, 0x0095, 0x0095, 0x0095, 0x0095, 0x0095, 0x0095, 
+  0x0095, 0x0095, 0x0095, 0x0095, 0x0095, 0x0095, 0x0095, 0x0095, 0x0095, 0x0095, 0x0095, 0x0095, 
+  0x0096, 0x0097, 0x0098, 0x0099, 0x009A, 0x009B, 0x009C, 0x009D, 0x009E, 0x00A0, 0x00A1, 0x00A2, 
+  0x00A3, 0x00A4, 0x00A5, 0x00A7, 0x00A8, 0x00A9, 0x00AA, 0x00AB, 0x00AC, 0x00AD, 0x00AE, 0x00B0, 
+  0x00B2, 0x00B3, 0x00B4, 0x00B5, 0x00B6, 0x00B8, 0x00B9, 0x00BA, 0x00BB, 0x00BC, 0x00BD, 0x00BE, 
+  0x00BF, 0x00C0, 0x00C1, 0x00C2, 0x00C2, 0x00C2, 0x00C2, 0x00C2, 0x00C2, 0x00C2, 0x00C2, 0x00C2, 
+  0x00C2, 0x00C2, 0x00C2, 0x00C2, 0x00C2, 0x00C2, 0x00C2, 0x00C2, 0x00C2, 0x00C2, 0x00C2, 0x00C2, 
+  0x00C2, 0x00C2, 0x00C2, 0x00C2, 0x00C3, 0x00C4, 0x00C6, 0x00C7, 0x00C8, 0x00CA, 0x00CC, 0x00CD, 
+  0x00CF, 0x00D1, 0x00D3, 0x00D5, 0x00D6, 0x00D7, 0x00D8, 0x00D9, 0x00DA, 0x00DD, 0x00E0, 0x00E2, 
+  0x00E3, 0x00E4, 0x00E5, 0x00E7, 0x00EC, 0x00EE, 0x00EE, 0x00EE, 0x00EE, 0x00EE, 0x00EE, 0x00EE, 
+  0x00EE, 0x00EE, 0x00EE, 0x00EE, 0x00EE, 0x00EE, 0x00EE, 0x00EE, 0x00EE, 0x00EE, 0x00EE, 0x00EE, 
+  0x00EE, 0x00EE, 0x00EE, 0x00EE, 0x00EE, 0x00EE, 0x00EE, 0x00EE, 0x00EE, 0x00EE, 0x00EE, 0x00EE, 
+  0x00EE, 0x00EF, 0x00F0, 0x00F1, 0x00F2, 0x00F3, 0x00F5, 0x00F7, 0x00F8, 0x00FA, 0x00FC, 0x00FE, 
+  0x00FF, 0x0100, 0x0101, 0x0102, 0x0103, 0x0104, 0x0107, 0x010A, 0x010D, 0x010E, 0x010F, 0x0110, 
+  0x0112, 0x0115, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 
+  0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 
+  0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x011A, 0x011B, 0x011C, 0x011D, 0x011E, 0x011F, 
+  0x0120, 0x0121, 0x0122, 0x0123, 0x0125, 0x0126, 0x0127, 0x0129, 0x012B, 0x012D, 0x012F, 0x0131, 
+  0x0132, 0x0133, 0x0134, 0x0135, 0x0136, 0x0138, 0x0139, 0x013A, 0x013B, 0x013E, 0x0140, 0x0142, 
+  0x0144, 0x0146, 0x0148, 0x014A, 0x014C, 0x014C, 0x014C, 0x014C, 0x014C, 0x014C, 0x014C, 0x014C, 
+  0x014C, 0x014C, 0x014C, 0x014C, 0x014C, 0x014C, 0x014C, 0x014C, 0x014C, 0x014C, 0x014C, 0x014C, 
+  0x014C, 0x014C, 0x014C, 0x014D, 0x014E, 0x014F, 0x0150, 0x0151, 0x0152, 0x0153, 0x0155, 0x0158, 
+  0x015A, 0x015B, 0x015D, 0x015F, 0x0161, 0x0162, 0x0163, 0x0164, 0x0165, 0x0166, 0x0167, 0x0169, 
+  0x016B, 0x016D, 0x016E, 0x0170, 0x0171, 0x0172, 0x0173, 0x0175, 0x0178, 0x017A, 0x017B, 0x017C, 
+  0x017D, 0x017E, 0x017E, 0x017E, 0x017E, 0x017E, 0x017E, 0x017E, 0x017E, 0x017E, 0x017E, 0x017E, 
+  0x017E, 0x017E, 0x017E, 0x017E, 0x017E, 0x017E, 0x017E, 0x017E, 0x017E, 0x017E, 0x017E, 0x017F, 
+  0x0180, 0x0181, 0x0182, 0x0183, 0x0184, 0x0185, 0x0187, 0x0189, 0x018B, 0x018D, 0x0190, 0x0194, 
+  0x0199, 0x019B, 0x019C, 0x019D, 0x019E, 0x019F, 0x01A0, 0x01A1, 0x01A2, 0x01A3, 0x01A4, 0x01A5, 
+  0x01A7, 0x01A8, 0x01A9, 0x01AA, 0x01AC, 0x01AF, 0x01B1, 0x01B3, 0x01B5, 0x01B6, 0x01B7, 0x01B8, 
+  0x01B8, 0x01B8, 0x01B8, 0x01B8, 0x01B8, 0x01B8, 0x01B8, 0x01B8, 0x01B8, 0x01B8, 0x01B8, 0x01B8, 
+  0x01B8, 0x01B8, 0x01B8, 0x01B8, 0x01B8, 0x01B8, 0x01B8, 0x01B8, 0x01B8, 0x01B9, 0x01BA, 0x01BB, 
+  0x01BC, 0x01BD, 0x01BE, 0x01BF, 0x01C0, 0x01C1, 0x01C2, 0x01C3, 0x01C5, 0x01C6, 0x01C8, 0x01C9, 
+  0x01CB, 0x01CD, 0x01CF, 0x01D0, 0x01D1, 0x01D2, 0x01D3, 0x01D4, 0x01D6, 0x01D8, 0x01D9, 0x01DB, 
+  0x01DC, 0x01DD, 0x01E0, 0x01E2, 0x01E4, 0x01E6, 0x01E8, 0x01E9, 0x01E9, 0x01E9, 0x01E9, 0x01E9, 
+  0x01E9, 0x01E9, 0x01E9, 0x01E9, 0x01E9, 0x01E9, 0x01E9, 0x01E9, 0x01E9, 0x01E9, 0x01E9, 0x01E9, 
+  0x01E9, 0x01E9, 0x01EA, 0x01EB, 0x01EC, 0x01ED, 0x01EE, 0x01EF, 0x01F0, 0x01F1, 0x01F2, 0x01F3, 
+  0x01F4, 0x01F5, 0x01F6, 0x01F8, 0x01FA, 0x01FC, 0x01FE, 0x0200, 0x0202, 0x0204, 0x0206, 0x0207, 
+  0x0209, 0x020B, 0x020E, 0x0211, 0x0214, 0x0216, 0x0218, 0x0219, 0x021A, 0x021B, 0x021C, 0x021D, 
+  0x021F, 0x0221, 0x0222, 0x0224, 0x0226, 0x0228, 0x022B, 0x022D, 0x022E, 0x022E, 0x022E, 0x022E, 
+  0x022E, 0x022E, 0x022E, 0x022E, 0x022E, 0x022E, 0x022E, 0x022E, 0x022E, 0x022E, 0x022F, 0x0230, 
+  0x0231, 0x0232, 0x0233, 0x0234, 0x0235, 0x0236, 0x0237, 0x0238, 0x0239, 0x023A, 0x023B, 0x023C, 
+  0x023D, 0x023E, 0x0240, 0x0242, 0x0244, 0x0246, 0x0248, 0x024A, 0x024C, 0x024E, 0x0250, 0x0252, 
+  0x0255, 0x0258, 0x025B, 0x025D, 0x025F, 0x0260, 0x0261, 0x0262, 0x0263, 0x0264, 0x0266, 0x0268, 
+  0x0269, 0x026B, 0x026D, 0x026F, 0x0272, 0x0274, 0x0276, 0x0276, 0x0276, 0x0276, 0x0276, 0x0276, 
+  0x0276, 0x0276, 0x0276, 0x0276, 0x0276, 0x0276, 0x0276, 0x0276, 0x0277, 0x0278, 0x027A, 0x027B, 
+  0x027C, 0x027D, 0x027F, 0x0282, 0x0286, 0x028A, 0x028D, 0x0290, 0x0293, 0x0295, 0x0297, 0x0298, 
+  0x0299, 0x029A, 0x029C, 0x029E, 0x029F, 0x02A1, 0x02A2, 0x02A3, 0x02A4, 0x02A5, 0x02A7, 0x02A8, 
+  0x02A9, 0x02AB, 0x02AC, 0x02AD, 0x02AE, 0x02B0, 0x02B2, 0x02B3, 0x02B4, 0x02B5, 0x02B6, 0x02B7, 
+  0x02B8, 0x02B9, 0x02B9, 0x02B9, 0x02B9, 0x02B9, 0x02B9, 0x02B9, 0x02B9, 0x02B9, 0x02B9, 0x02B9, 
+  0x02B9, 0x02B9, 0x02B9, 0x02B9, 0x02B9, 0x02B9, 0x02B9, 0x02B9, 0x02BA, 0x02BB, 0x02BC, 0x02BD, 
+  0x02BE, 0x02BF, 0x02C0, 0x02C2, 0x02C5, 0x02C8, 0x02CA, 0x02CC, 0x02CE, 0x02D0, 0x02D2, 0x02D4, 
+  0x02D7, 0x02D8, 0x02D9, 0x02DA, 0x02DB, 0x02DD, 0x02DF, 0x02E1, 0x02E3, 0x02E7, 0x02EA, 0x02EC, 
+  0x02ED, 0x02EE, 0x02EF, 0x02F0, 0x02F1, 0x02F2, 0x02F3, 0x02F4, 0x02F4, 0x02F4, 0x02F4, 0x02F4, 
+  0x02F4, 0x02F4, 0x02F4, 0x02F4, 0x02F4, 0x02F4, 0x02F4, 0x02F4, 0x02F4, 0x02F4, 0x02F4, 0x02F4, 
+  0x02F4, 0x02F4, 0x02F4, 0x02F4, 0x02F5, 0x02F6, 0x02F7, 0x02F8, 0x02F9, 0x02FB, 0x02FD, 0x0301, 
+  0x0304, 0x0307, 0x030B, 0x030D, 0x0310, 0x0312, 0x0313, 0x0314, 0x0315, 0x0316, 0x0317, 0x0318, 
+  0x031A, 0x031B, 0x031C, 0x031D, 0x031F, 0x0320, 0x0322, 0x0323, 0x0325, 0x0327, 0x0328, 0x0329, 
+  0x032A, 0x032B, 0x032C, 0x032D, 0x032E, 0x032F, 0x032F, 0x032F, 0x032F, 0x032F, 0x032F, 0x032F, 
+  0x032F, 0x032F, 0x032F, 0x032F, 0x032F, 0x032F, 0x032F, 0x032F, 0x032F, 0x032F, 0x032F, 0x032F, 
+  0x032F, 0x032F, 0x032F, 0x0330, 0x0331, 0x0332, 0x0333, 0x0334, 0x0335, 0x0336, 0x0337, 0x0339, 
+  0x033B, 0x033D, 0x033E, 0x033F, 0x0340, 0x0342, 0x0344, 0x0345, 0x0347, 0x0349, 0x034B, 0x034D, 
+  0x034F, 0x0350, 0x0351, 0x0352, 0x0353, 0x0355, 0x0358, 0x035A, 0x035B, 0x035C, 0x035D, 0x035E, 
+  0x035F, 0x035F, 0x035F, 0x035F, 0x035F, 0x035F, 0x035F, 0x035F, 0x035F, 0x035F, 0x035F, 0x035F, 
+  0x035F, 0x035F, 0x035F, 0x035F, 0x0360, 0x0361, 0x0362, 0x0363, 0x0364, 0x0365, 0x0366, 0x0367, 
+  0x0368, 0x0369, 0x036A, 0x036B, 0x036C, 0x036D, 0x036E, 0x036F, 0x0371, 0x0374, 0x0377, 0x037A, 
+  0x037D, 0x0380, 0x0383, 0x0385, 0x0387, 0x0389, 0x038C, 0x038E, 0x0390, 0x0391, 0x0392, 0x0394, 
+  0x0395, 0x0396, 0x0397, 0x0398, 0x0399, 0x039A, 0x039B, 0x039D, 0x03A0, 0x03A2, 0x03A4, 0x03A8, 
+  0x03AB, 0x03AD, 0x03AE, 0x03AF, 0x03B0, 0x03B1, 0x03B2, 0x03B2, 0x03B2, 0x03B2, 0x03B2, 0x03B2, 
+  0x03B3, 0x03B4, 0x03B5, 0x03B6, 0x03B7, 0x03B8, 0x03B9, 0x03BA, 0x03BB, 0x03BC, 0x03BD, 0x03BE, 
+  0x03BF, 0x03C0, 0x03C1, 0x03C2, 0x03C3, 0x03C4, 0x03C6, 0x03C9, 0x03CC, 0x03CF, 0x03D2, 0x03D4, 
+  0x03D6, 0x03D8, 0x03DA, 0x03DC, 0x03DF, 0x03E0, 0x03E1, 0x03E2, 0x03E4, 0x03E5, 0x03E6, 0x03E7, 
+  0x03E8, 0x03E9, 0x03EA, 0x03EB, 0x03EC, 0x03EF, 0x03F2, 0x03F4, 0x03F7, 0x03F9, 0x03FC, 0x03FE, 
+  0x03FF, 0x0400, 0x0401, 0x0402, 0x0402, 0x0402, 0x0402, 0x0402, 0x0402, 0x0402, 0x0402, 0x0402, 
+  0x0402, 0x0403, 0x0404, 0x0405, 0x0406, 0x0407, 0x0408, 0x0409, 0x040A, 0x040B, 0x040C, 0x040D, 
+  0x040E, 0x040F, 0x0411, 0x0413, 0x0417, 0x041B, 0x041D, 0x041E, 0x041F, 0x0420, 0x0421, 0x0423, 
+  0x0425, 0x0426, 0x0427, 0x0428, 0x042A, 0x042B, 0x042C, 0x042D, 0x042E, 0x042F, 0x0430, 0x0431, 
+  0x0432, 0x0433, 0x0435, 0x0437, 0x0438, 0x0439, 0x043A, 0x043B, 0x043C, 0x043D, 0x043D, 0x043D, 
+  0x043D, 0x043D, 0x043D, 0x043D, 0x043D, 0x043D, 0x043D, 0x043D, 0x043D, 0x043D, 0x043D, 0x043D, 
+  0x043E, 0x043F, 0x0440, 0x0442, 0x0443, 0x0444, 0x0445, 0x0446, 0x0447, 0x0448, 0x0449, 0x044A, 
+  0x044B, 0x044C, 0x044D, 0x044E, 0x0450, 0x0452, 0x0454, 0x0456, 0x0458, 0x0459, 0x045A, 0x045B, 
+  0x045C, 0x045D, 0x0460, 0x0461, 0x0463, 0x0464, 0x0465, 0x0466, 0x0469, 0x046B, 0x046C, 0x046F, 
+  0x0470, 0x0471, 0x0472, 0x0473, 0x0474, 0x0474, 0x0474, 0x0474, 0x0474, 0x0474, 0x0474, 0x0474, 
+  0x0474, 0x0474, 0x0474, 0x0474, 0x0474, 0x0474, 0x0474, 0x0474, 0x0474, 0x0475, 0x0476, 0x0477, 
+  0x0478, 0x0479, 0x047A, 0x047B, 0x047C, 0x047D, 0x047E, 0x047F, 0x0480, 0x0481, 0x0482, 0x0483, 
+  0x0484, 0x0485, 0x0486, 0x0487, 0x0488, 0x048A, 0x048C, 0x048E, 0x0490, 0x0492, 0x0493, 0x0494, 
+  0x0495, 0x0496, 0x0498, 0x0499, 0x049B, 0x049E, 0x04A0, 0x04A2, 0x04A4, 0x04A7, 0x04A8, 0x04A9, 
+  0x04AA, 0x04AB, 0x04AB, 0x04AB, 0x04AB, 0x04AB, 0x04AB, 0x04AB, 0x04AB, 0x04AB, 0x04AB, 0x04AB, 
+  0x04AB, 0x04AB, 0x04AB, 0x04AB, 0x04AB, 0x04AB, 0x04AC, 0x04AD, 0x04AE, 0x04AF, 0x04B0, 0x04B1, 
+  0x04B2, 0x04B3, 0x04B4, 0x04B5, 0x04B6, 0x04B7, 0x04B8, 0x04B9, 0x04BA, 0x04BB, 0x04BC, 0x04BF, 
+  0x04C0, 0x04C1, 0x04C2, 0x04C3, 0x04C5, 0x04C6, 0x04C7, 0x04C8, 0x04C9, 0x04CB, 0x04CD, 0x04D0, 
+  0x04D2, 0x04D3, 0x04D4, 0x04D5, 0x04D7, 0x04D9, 0x04DB, 0x04DD, 0x04DE, 0x04DF, 0x04DF, 0x04DF, 
+  0x04DF, 0x04DF, 0x04DF, 0x04DF, 0x04DF, 0x04DF, 0x04DF, 0x04DF, 0x04DF, 0x04DF, 0x04DF, 0x04DF, 
+  0x04DF, 0x04DF, 0x04DF, 0x04DF, 0x04E0, 0x04E1, 0x04E2, 0x04E3, 0x04E4, 0x04E5, 0x04E7, 0x04E9, 
+  0x04EB, 0x04ED, 0x04EF, 0x04F1, 0x04F2, 0x04F3, 0x04F4, 0x04F5, 0x04F6, 0x04F7, 0x04F8, 0x04F9, 
+  0x04FA, 0x04FB, 0x04FC, 0x04FD, 0x04FE, 0x0500, 0x0501, 0x0502, 0x0503, 0x0505, 0x0507, 0x0509, 
+  0x050B, 0x050D, 0x050F, 0x0511, 0x0513, 0x0514, 0x0514, 0x0514, 0x0514, 0x0514, 0x0514, 0x0514, 
+  0x0514, 0x0514, 0x0514, 0x0514, 0x0514, 0x0514, 0x0514, 0x0514, 0x0514, 0x0514, 0x0514, 0x0514, 
+  0x0515, 0x0516, 0x0517, 0x0518, 0x0519, 0x051A, 0x051B, 0x051C, 0x051F, 0x0521, 0x0523, 0x0525, 
+  0x0527, 0x0529, 0x052A, 0x052B, 0x052C, 0x052D, 0x052E, 0x052F, 0x0530, 0x0531, 0x0532, 0x0533, 
+  0x0534, 0x0535, 0x0536, 0x0537, 0x0539, 0x053A, 0x053B, 0x053C, 0x053E, 0x0540, 0x0542, 0x0544, 
+  0x0546, 0x0548, 0x054A, 0x054B, 0x054C, 0x054C, 0x054C, 0x054C, 0x054C, 0x054C, 0x054C, 0x054C, 
+  0x054C, 0x054C, 0x054C, 0x054C, 0x054C, 0x054C, 0x054C, 0x054C, 0x054C, 0x054C, 0x054C, 0x054D, 
+  0x054E, 0x054F, 0x0550, 0x0551, 0x0552, 0x0553, 0x0554, 0x0555, 0x0556, 0x0557, 0x0558, 0x0559, 
+  0x055A, 0x055B, 0x055C, 0x055E, 0x055F, 0x0560, 0x0561, 0x0562, 0x0563, 0x0564, 0x0565, 0x0566, 
+  0x0567, 0x0568, 0x0569, 0x056C, 0x056D, 0x056E, 0x056F, 0x0571, 0x0572, 0x0573, 0x0574, 0x0574, 
+  0x0574, 0x0574, 0x0574, 0x0574, 0x0574, 0x0574, 0x0574, 0x0574, 0x0574, 0x0574, 0x0574, 0x0574, 
+  0x0574, 0x0574, 0x0574, 0x0574, 0x0574, 0x0574, 0x0574, 0x0574, 0x0574, 0x0575, 0x0576, 0x0577, 
+  0x0578, 0x057A, 0x057B, 0x057C, 0x057D, 0x057E, 0x057F, 0x0581, 0x0583, 0x0585, 0x0586, 0x0588, 
+  0x0589, 0x058A, 0x058B, 0x058C, 0x058D, 0x058F, 0x0590, 0x0591, 0x0592, 0x0593, 0x0594, 0x0597, 
+  0x0598, 0x0599, 0x059B, 0x059C, 0x059D, 0x059E, 0x059F, 0x05A0, 0x05A0, 0x05A0, 0x05A0, 0x05A0, 
+  0x05A0, 0x05A0, 0x05A0, 0x05A0, 0x05A0, 0x05A0, 0x05A0, 0x05A0, 0x05A0, 0x05A0, 0x05A0, 0x05A0, 
+  0x05A0, 0x05A0, 0x05A0, 0x05A0, 0x05A0, 0x05A0, 0x05A1, 0x05A2, 0x05A3, 0x05A5, 0x05A6, 0x05A7, 
+  0x05A8, 0x05A9, 0x05AB, 0x05AD, 0x05AE, 0x05B1, 0x05B2, 0x05B3, 0x05B4, 0x05B5, 0x05B6, 0x05B7, 
+  0x05B8, 0x05BB, 0x05BC, 0x05BD, 0x05BE, 0x05C0, 0x05C2, 0x05C3, 0x05C5, 0x05C6, 0x05C7, 0x05C8, 
+  0x05C9, 0x05CA, 0x05CB, 0x05CC, 0x05CC, 0x05CC, 0x05CC, 0x05CC, 0x05CC, 0x05CC, 0x05CC, 0x05CC, 
+  0x05CC, 0x05CC, 0x05CC, 0x05CC, 0x05CC, 0x05CC, 0x05CC, 0x05CC, 0x05CC, 0x05CC, 0x05CC, 0x05CC, 
+  0x05CC, 0x05CC, 0x05CC, 0x05CD, 0x05CE, 0x05CF, 0x05D0, 0x05D1, 0x05D3, 0x05D4, 0x05D5, 0x05D6, 
+  0x05D7, 0x05D9, 0x05DC, 0x05DD, 0x05DF, 0x05E1, 0x05E2, 0x05E3, 0x05E4, 0x05E5, 0x05E6, 0x05E9, 
+  0x05EB, 0x05EC, 0x05ED, 0x05EE, 0x05EF, 0x05F2, 0x05F3, 0x05F5, 0x05F6, 0x05F7, 0x05F8, 0x05F9, 
+  0x05FA, 0x05FB, 0x05FB, 0x05FB, 0x05FB, 0x05FB, 0x05FB, 0x05FB, 0x05FB, 0x05FB, 0x05FB, 0x05FB, 
+  0x05FB, 0x05FB, 0x05FB, 0x05FB, 0x05FB, 0x05FB, 0x05FB, 0x05FB, 0x05FB, 0x05FB, 0x05FB, 0x05FB, 
+  0x05FB, 0x05FB, 0x05FB, 0x05FB, 0x05FC, 0x05FF, 0x0600, 0x0602, 0x0603, 0x0605, 0x0607, 0x0608, 
+  0x060A, 0x060C, 0x060F, 0x0610, 0x0611, 0x0612, 0x0613, 0x0614, 0x0616, 0x0618, 0x061B, 0x061E, 
+  0x0620, 0x0621, 0x0622, 0x0623, 0x0624, 0x0625, 0x0625, 0x0625, 0x0625, 0x0625, 0x0625, 0x0625, 
+  0x0625, 0x0625, 0x0625, 0x0625, 0x0625, 0x0625, 0x0625, 0x0625, 0x0625, 0x0625, 0x0625, 0x0625, 
+  0x0625, 0x0625, 0x0625, 0x0625, 0x0625, 0x0625, 0x0625, 0x0625, 0x0625, 0x0625, 0x0625, 0x0625, 
+  0x0625, 0x0625, 0x0628, 0x0629, 0x062B, 0x062C, 0x062D, 0x062F, 0x0630, 0x0632, 0x0634, 0x0636, 
+  0x0637, 0x0638, 0x0639, 0x063A, 0x063B, 0x063D, 0x063F, 0x0642, 0x0645, 0x0647, 0x0648, 0x0649, 
+  0x064A, 0x064B, 0x064B, 0x064B, 0x064B, 0x064B, 0x064B, 0x064B, 0x064B, 0x064B, 0x064B, 0x064B, 
+  0x064B, 0x064B, 0x064B, 0x064B, 0x064B, 0x064B, 0x064B, 
+};
+static const u8 g_player_spans_mip0[3222] = {
+  0x15, 0x1C, 0x0F, 0x1D, 0x0E, 0x1D, 0x0E, 0x1E, 0x0D, 0x1F, 0x0D, 0x20, 0x0D, 0x25, 0x08, 0x0A, 
+  0x0D, 0x28, 0x07, 0x0B, 0x0C, 0x2B, 0x06, 0x2D, 0x05, 0x2E, 0x04, 0x2E, 0x04, 0x2F, 0x33, 0x36, 
+  0x03, 0x37, 0x03, 0x37, 0x03, 0x3A, 0x03, 0x3B, 0x04, 0x3B, 0x04, 0x3B, 0x05, 0x3B, 0x06, 0x3B, 
+  0x08, 0x0A, 0x0C, 0x3B, 0x0C, 0x2C, 0x2D, 0x32, 0x0D, 0x1D, 0x1E, 0x26, 0x0D, 0x19, 0x1F, 0x25, 
+  0x0D, 0x1A, 0x0E, 0x1A, 0x0F, 0x1A, 0x12, 0x1A, 0x11, 0x1A, 0x11, 0x1A, 0x10, 0x19, 0x10, 0x19, 
+  0x10, 0x18, 0x10, 0x13, 0x0F, 0x13, 0x0F, 0x12, 0x0E, 0x12, 0x0E, 0x11, 0x0E, 0x11, 0x0E, 0x10, 
+  0x19, 0x1C, 0x15, 0x1D, 0x10, 0x1F, 0x0F, 0x20, 0x0E, 0x21, 0x0E, 0x22, 0x0E, 0x26, 0x0E, 0x18, 
+  0x1A, 0x27, 0x28, 0x2A, 0x08, 0x0A, 0x0E, 0x2B, 0x07, 0x0B, 0x0D, 0x2E, 0x06, 0x30, 0x05, 0x31, 
+  0x04, 0x32, 0x34, 0x38, 0x03, 0x39, 0x03, 0x39, 0x03, 0x39, 0x03, 0x38, 0x03, 0x2B, 0x32, 0x36, 
+  0x04, 0x32, 0x05, 0x34, 0x35, 0x3B, 0x06, 0x3B, 0x07, 0x0B, 0x0D, 0x3B, 0x08, 0x0A, 0x0D, 0x3B, 
+  0x0D, 0x3B, 0x0D, 0x19, 0x1A, 0x1E, 0x1F, 0x34, 0x35, 0x3B, 0x0E, 0x1A, 0x1F, 0x2A, 0x0E, 0x1A, 
+  0x21, 0x26, 0x0F, 0x1B, 0x10, 0x1B, 0x10, 0x1B, 0x0F, 0x1A, 0x0F, 0x1A, 0x0E, 0x12, 0x14, 0x19, 
+  0x0E, 0x11, 0x0D, 0x10, 0x0D, 0x10, 0x0D, 0x0F, 0x17, 0x1D, 0x13, 0x1F, 0x0F, 0x20, 0x0E, 0x21, 
+  0x0D, 0x21, 0x0D, 0x25, 0x0D, 0x26, 0x27, 0x29, 0x0D, 0x2B, 0x0C, 0x32, 0x08, 0x0A, 0x0C, 0x34, 
+  0x36, 0x3A, 0x07, 0x3B, 0x06, 0x3B, 0x05, 0x3B, 0x04, 0x3B, 0x03, 0x34, 0x36, 0x3B, 0x03, 0x2A, 
+  0x2C, 0x30, 0x38, 0x3A, 0x03, 0x38, 0x03, 0x38, 0x03, 0x38, 0x04, 0x38, 0x05, 0x38, 0x06, 0x31, 
+  0x08, 0x0B, 0x0D, 0x2F, 0x09, 0x0A, 0x0D, 0x1D, 0x1F, 0x2B, 0x0D, 0x19, 0x20, 0x26, 0x0E, 0x1A, 
+  0x0E, 0x1B, 0x0E, 0x1B, 0x0F, 0x1B, 0x11, 0x1B, 0x11, 0x1A, 0x10, 0x14, 0x16, 0x1A, 0x10, 0x13, 
+  0x0F, 0x13, 0x0F, 0x12, 0x0F, 0x12, 0x0E, 0x11, 0x0E, 0x11, 0x18, 0x1C, 0x13, 0x1D, 0x0F, 0x20, 
+  0x0E, 0x21, 0x0D, 0x22, 0x0D, 0x26, 0x0D, 0x2D, 0x0D, 0x32, 0x0C, 0x3B, 0x09, 0x0A, 0x0C, 0x3B, 
+  0x08, 0x3B, 0x07, 0x3B, 0x06, 0x3B, 0x05, 0x32, 0x05, 0x30, 0x04, 0x2B, 0x2C, 0x38, 0x04, 0x39, 
+  0x04, 0x39, 0x04, 0x39, 0x05, 0x38, 0x06, 0x31, 0x06, 0x30, 0x07, 0x2F, 0x09, 0x0B, 0x0D, 0x2B, 
+  0x0D, 0x1C, 0x20, 0x26, 0x0E, 0x1C, 0x0E, 0x1B, 0x0E, 0x1B, 0x0F, 0x1C, 0x11, 0x13, 0x15, 0x1C, 
+  0x15, 0x1C, 0x14, 0x1C, 0x14, 0x1B, 0x14, 0x18, 0x14, 0x17, 0x13, 0x16, 0x13, 0x16, 0x13, 0x16, 
+  0x12, 0x15, 0x12, 0x15, 0x19, 0x1E, 0x17, 0x20, 0x11, 0x13, 0x15, 0x20, 0x10, 0x20, 0x0F, 0x20, 
+  0x0A, 0x0B, 0x0E, 0x22, 0x08, 0x0D, 0x0E, 0x27, 0x07, 0x2E, 0x05, 0x2F, 0x36, 0x38, 0x04, 0x30, 
+  0x35, 0x38, 0x03, 0x31, 0x34, 0x38, 0x03, 0x32, 0x33, 0x38, 0x03, 0x38, 0x03, 0x38, 0x04, 0x38, 
+  0x05, 0x37, 0x05, 0x37, 0x07, 0x32, 0x33, 0x36, 0x39, 0x3B, 0x08, 0x0B, 0x0D, 0x34, 0x38, 0x3B, 
+  0x09, 0x0A, 0x0D, 0x3B, 0x0D, 0x3B, 0x0D, 0x3B, 0x0E, 0x3B, 0x0E, 0x1E, 0x1F, 0x3B, 0x0F, 0x17, 
+  0x1B, 0x1D, 0x20, 0x2B, 0x2E, 0x33, 0x37, 0x3A, 0x11, 0x15, 0x21, 0x26, 0x19, 0x1E, 0x17, 0x20, 
+  0x15, 0x20, 0x11, 0x20, 0x10, 0x20, 0x0A, 0x0B, 0x0F, 0x22, 0x08, 0x0D, 0x0E, 0x28, 0x07, 0x2F, 
+  0x05, 0x30, 0x36, 0x38, 0x04, 0x30, 0x35, 0x38, 0x03, 0x31, 0x34, 0x38, 0x03, 0x38, 0x03, 0x38, 
+  0x03, 0x38, 0x04, 0x38, 0x05, 0x37, 0x05, 0x36, 0x07, 0x30, 0x32, 0x35, 0x39, 0x3B, 0x08, 0x0B, 
+  0x0D, 0x31, 0x38, 0x3B, 0x09, 0x0A, 0x0D, 0x33, 0x35, 0x3B, 0x0D, 0x3B, 0x0D, 0x3B, 0x0E, 0x3B, 
+  0x0E, 0x19, 0x1B, 0x3B, 0x0F, 0x18, 0x1C, 0x1D, 0x1F, 0x3A, 0x11, 0x13, 0x21, 0x2B, 0x2E, 0x33, 
+  0x37, 0x3A, 0x1D, 0x1F, 0x1D, 0x20, 0x1C, 0x21, 0x1C, 0x22, 0x1B, 0x22, 0x18, 0x22, 0x17, 0x21, 
+  0x12, 0x21, 0x11, 0x22, 0x10, 0x22, 0x0B, 0x0C, 0x10, 0x22, 0x09, 0x22, 0x07, 0x22, 0x06, 0x23, 
+  0x38, 0x3B, 0x05, 0x26, 0x37, 0x3B, 0x05, 0x28, 0x37, 0x3B, 0x05, 0x2A, 0x37, 0x3B, 0x05, 0x33, 
+  0x35, 0x3B, 0x05, 0x3B, 0x06, 0x3B, 0x06, 0x3B, 0x07, 0x3B, 0x08, 0x3B, 0x09, 0x0C, 0x0D, 0x34, 
+  0x0E, 0x32, 0x0E, 0x2F, 0x0E, 0x30, 0x0E, 0x26, 0x29, 0x31, 0x34, 0x37, 0x0E, 0x22, 0x2A, 0x37, 
+  0x0E, 0x1B, 0x2B, 0x37, 0x0F, 0x1B, 0x2D, 0x37, 0x0F, 0x1B, 0x2E, 0x37, 0x10, 0x1B, 0x2E, 0x36, 
+  0x15, 0x1B, 0x2F, 0x34, 0x17, 0x1A, 0x30, 0x33, 0x1E, 0x1F, 0x1D, 0x20, 0x1C, 0x21, 0x1C, 0x22, 
+  0x18, 0x23, 0x18, 0x22, 0x17, 0x21, 0x16, 0x18, 0x19, 0x21, 0x12, 0x14, 0x16, 0x17, 0x18, 0x22, 
+  0x11, 0x17, 0x18, 0x22, 0x10, 0x22, 0x0D, 0x0E, 0x10, 0x22, 0x0A, 0x0E, 0x0F, 0x22, 0x08, 0x1C, 
+  0x1E, 0x21, 0x06, 0x27, 0x04, 0x2A, 0x04, 0x2E, 0x04, 0x2F, 0x04, 0x2F, 0x04, 0x30, 0x04, 0x31, 
+  0x38, 0x3B, 0x05, 0x32, 0x37, 0x3B, 0x06, 0x34, 0x36, 0x3B, 0x07, 0x3B, 0x08, 0x0C, 0x0D, 0x3B, 
+  0x0E, 0x3B, 0x0E, 0x3B, 0x0D, 0x3A, 0x0D, 0x27, 0x2F, 0x38, 0x0D, 0x1F, 0x21, 0x26, 0x32, 0x37, 
+  0x0F, 0x1B, 0x33, 0x36, 0x0F, 0x1B, 0x10, 0x1B, 0x15, 0x1A, 0x17, 0x19, 0x1C, 0x1F, 0x1C, 0x21, 
+  0x1B, 0x22, 0x1A, 0x22, 0x18, 0x21, 0x17, 0x21, 0x16, 0x22, 0x16, 0x18, 0x19, 0x22, 0x15, 0x17, 
+  0x18, 0x22, 0x15, 0x16, 0x17, 0x22, 0x11, 0x22, 0x39, 0x3B, 0x10, 0x1D, 0x1F, 0x21, 0x38, 0x3B, 
+  0x0D, 0x0E, 0x0F, 0x1E, 0x24, 0x26, 0x38, 0x3B, 0x0C, 0x0E, 0x0F, 0x28, 0x2A, 0x2E, 0x2F, 0x30, 
+  0x37, 0x3B, 0x08, 0x32, 0x36, 0x3B, 0x06, 0x3B, 0x04, 0x3B, 0x04, 0x3B, 0x04, 0x3B, 0x04, 0x3B, 
+  0x04, 0x33, 0x04, 0x2A, 0x05, 0x28, 0x06, 0x2A, 0x07, 0x2C, 0x08, 0x0C, 0x0D, 0x2F, 0x0E, 0x30, 
+  0x0E, 0x31, 0x0E, 0x32, 0x0F, 0x33, 0x37, 0x3A, 0x0F, 0x1E, 0x22, 0x34, 0x36, 0x3A, 0x0F, 0x1C, 
+  0x28, 0x3A, 0x10, 0x1C, 0x2C, 0x3A, 0x15, 0x1B, 0x2D, 0x3A, 0x2F, 0x39, 0x32, 0x38, 0x33, 0x37, 
+  0x1D, 0x1F, 0x1C, 0x20, 0x1C, 0x21, 0x1C, 0x22, 0x19, 0x22, 0x18, 0x21, 0x18, 0x20, 0x15, 0x21, 
+  0x11, 0x22, 0x10, 0x22, 0x0F, 0x22, 0x09, 0x0E, 0x0F, 0x23, 0x07, 0x27, 0x06, 0x29, 0x2A, 0x2D, 
+  0x05, 0x2E, 0x04, 0x31, 0x39, 0x3B, 0x04, 0x32, 0x38, 0x3B, 0x04, 0x34, 0x37, 0x3B, 0x04, 0x3B, 
+  0x04, 0x3B, 0x05, 0x3B, 0x05, 0x3A, 0x06, 0x3A, 0x07, 0x30, 0x33, 0x39, 0x0D, 0x31, 0x35, 0x38, 
+  0x0E, 0x32, 0x0E, 0x33, 0x37, 0x39, 0x0E, 0x3A, 0x0E, 0x3A, 0x0E, 0x1B, 0x1D, 0x27, 0x2B, 0x3A, 
+  0x0F, 0x1B, 0x2D, 0x3A, 0x0F, 0x1B, 0x30, 0x39, 0x11, 0x1B, 0x31, 0x37, 0x15, 0x1A, 0x32, 0x34, 
+  0x18, 0x19, 0x19, 0x1B, 0x19, 0x1B, 0x19, 0x1B, 0x19, 0x1B, 0x19, 0x1B, 0x19, 0x1B, 0x18, 0x1C, 
+  0x18, 0x1D, 0x18, 0x1D, 0x18, 0x1D, 0x17, 0x1D, 0x16, 0x1D, 0x16, 0x1D, 0x16, 0x17, 0x18, 0x1D, 
+  0x16, 0x17, 0x18, 0x1F, 0x16, 0x17, 0x18, 0x20, 0x16, 0x17, 0x18, 0x21, 0x16, 0x17, 0x18, 0x22, 
+  0x16, 0x17, 0x18, 0x22, 0x16, 0x17, 0x18, 0x22, 0x16, 0x17, 0x18, 0x20, 0x16, 0x20, 0x16, 0x20, 
+  0x39, 0x3B, 0x17, 0x20, 0x38, 0x3B, 0x0D, 0x0E, 0x18, 0x20, 0x38, 0x3B, 0x0B, 0x0F, 0x18, 0x1E, 
+  0x37, 0x3B, 0x08, 0x0F, 0x12, 0x1E, 0x37, 0x3B, 0x07, 0x21, 0x35, 0x3B, 0x06, 0x26, 0x29, 0x3B, 
+  0x04, 0x3B, 0x04, 0x3B, 0x04, 0x3B, 0x04, 0x3B, 0x05, 0x3B, 0x05, 0x34, 0x36, 0x3B, 0x06, 0x33, 
+  0x35, 0x39, 0x07, 0x39, 0x09, 0x0C, 0x0F, 0x39, 0x10, 0x28, 0x2C, 0x39, 0x11, 0x26, 0x2D, 0x39, 
+  0x18, 0x1A, 0x1B, 0x24, 0x2F, 0x39, 0x1C, 0x23, 0x33, 0x39, 0x35, 0x39, 0x19, 0x1B, 0x18, 0x1C, 
+  0x17, 0x1D, 0x17, 0x1D, 0x17, 0x1D, 0x18, 0x1C, 0x19, 0x1B, 0x19, 0x1B, 0x19, 0x1B, 0x18, 0x1C, 
+  0x18, 0x1D, 0x18, 0x1D, 0x18, 0x1D, 0x17, 0x1D, 0x16, 0x1D, 0x16, 0x1D, 0x16, 0x17, 0x18, 0x1D, 
+  0x16, 0x17, 0x18, 0x1F, 0x16, 0x17, 0x18, 0x20, 0x16, 0x17, 0x18, 0x21, 0x16, 0x17, 0x18, 0x22, 
+  0x16, 0x17, 0x18, 0x22, 0x16, 0x17, 0x18, 0x22, 0x16, 0x17, 0x18, 0x20, 0x16, 0x20, 0x39, 0x3B, 
+  0x16, 0x20, 0x38, 0x3B, 0x0D, 0x0E, 0x17, 0x20, 0x38, 0x3B, 0x0B, 0x0F, 0x18, 0x20, 0x37, 0x3B, 
+  0x08, 0x0F, 0x12, 0x1E, 0x37, 0x3B, 0x07, 0x23, 0x35, 0x3B, 0x06, 0x28, 0x29, 0x3B, 0x04, 0x3B, 
+  0x04, 0x3B, 0x04, 0x3B, 0x04, 0x3B, 0x05, 0x3B, 0x05, 0x34, 0x36, 0x3B, 0x06, 0x34, 0x35, 0x39, 
+  0x07, 0x39, 0x09, 0x0C, 0x0F, 0x39, 0x10, 0x28, 0x2D, 0x39, 0x11, 0x26, 0x2E, 0x39, 0x18, 0x1A, 
+  0x1B, 0x24, 0x30, 0x38, 0x1D, 0x23, 0x32, 0x38, 0x1F, 0x22, 0x34, 0x38, 0x17, 0x1E, 0x15, 0x21, 
+  0x15, 0x16, 0x17, 0x22, 0x15, 0x23, 0x12, 0x24, 0x11, 0x24, 0x11, 0x24, 0x39, 0x3B, 0x17, 0x1C, 
+  0x1D, 0x23, 0x38, 0x3B, 0x0D, 0x10, 0x19, 0x1C, 0x1E, 0x23, 0x38, 0x3B, 0x0B, 0x11, 0x19, 0x1C, 
+  0x1D, 0x22, 0x37, 0x3B, 0x08, 0x11, 0x19, 0x21, 0x37, 0x3B, 0x06, 0x11, 0x13, 0x21, 0x37, 0x3B, 
+  0x06, 0x20, 0x2C, 0x33, 0x36, 0x3B, 0x06, 0x20, 0x25, 0x3B, 0x06, 0x21, 0x23, 0x3B, 0x06, 0x3B, 
+  0x06, 0x3B, 0x07, 0x3B, 0x07, 0x35, 0x38, 0x3B, 0x08, 0x2E, 0x30, 0x33, 0x09, 0x2D, 0x0A, 0x0C, 
+  0x0E, 0x2A, 0x0F, 0x2A, 0x0F, 0x2B, 0x10, 0x2D, 0x11, 0x2E, 0x16, 0x1B, 0x1C, 0x2F, 0x1D, 0x30, 
+  0x1F, 0x30, 0x20, 0x22, 0x25, 0x31, 0x27, 0x31, 0x2A, 0x31, 0x2A, 0x32, 0x2B, 0x32, 0x37, 0x39, 
+  0x2C, 0x33, 0x36, 0x39, 0x2D, 0x39, 0x2E, 0x39, 0x2F, 0x39, 0x31, 0x39, 0x31, 0x38, 0x32, 0x36, 
+  0x32, 0x35, 0x17, 0x1C, 0x13, 0x20, 0x12, 0x22, 0x11, 0x22, 0x0E, 0x22, 0x0D, 0x21, 0x0D, 0x21, 
+  0x14, 0x19, 0x1C, 0x20, 0x0C, 0x0F, 0x14, 0x19, 0x1B, 0x20, 0x0A, 0x0F, 0x16, 0x19, 0x1A, 0x1F, 
+  0x07, 0x0F, 0x17, 0x1F, 0x06, 0x10, 0x11, 0x1E, 0x04, 0x1E, 0x38, 0x3B, 0x04, 0x28, 0x38, 0x3B, 
+  0x04, 0x2E, 0x37, 0x3B, 0x04, 0x30, 0x37, 0x3B, 0x04, 0x32, 0x35, 0x36, 0x37, 0x3B, 0x04, 0x3B, 
+  0x05, 0x3B, 0x06, 0x3B, 0x07, 0x3A, 0x08, 0x0C, 0x0D, 0x3A, 0x0E, 0x32, 0x35, 0x3A, 0x0F, 0x30, 
+  0x37, 0x39, 0x10, 0x22, 0x24, 0x31, 0x12, 0x19, 0x1B, 0x21, 0x28, 0x32, 0x36, 0x39, 0x1D, 0x1F, 
+  0x2B, 0x32, 0x35, 0x39, 0x2B, 0x33, 0x34, 0x39, 0x2C, 0x39, 0x2D, 0x39, 0x2E, 0x38, 0x30, 0x38, 
+  0x32, 0x37, 0x32, 0x37, 0x33, 0x36, 0x34, 0x35, 0x16, 0x1C, 0x11, 0x22, 0x10, 0x23, 0x10, 0x23, 
+  0x11, 0x23, 0x16, 0x1B, 0x1D, 0x23, 0x17, 0x1B, 0x1E, 0x22, 0x0D, 0x0F, 0x18, 0x1B, 0x1D, 0x21, 
+  0x38, 0x3A, 0x0B, 0x10, 0x19, 0x20, 0x37, 0x3A, 0x08, 0x10, 0x18, 0x1F, 0x37, 0x3A, 0x07, 0x10, 
+  0x13, 0x17, 0x18, 0x1F, 0x36, 0x3A, 0x05, 0x1E, 0x36, 0x3A, 0x05, 0x1F, 0x2A, 0x2E, 0x35, 0x3A, 
+  0x05, 0x21, 0x24, 0x3A, 0x05, 0x3A, 0x05, 0x3A, 0x05, 0x3A, 0x06, 0x3A, 0x07, 0x34, 0x08, 0x32, 
+  0x09, 0x0D, 0x0E, 0x2D, 0x0F, 0x2F, 0x10, 0x30, 0x11, 0x30, 0x13, 0x1A, 0x1B, 0x31, 0x1B, 0x31, 
+  0x1E, 0x24, 0x28, 0x32, 0x2A, 0x33, 0x2C, 0x33, 0x38, 0x3B, 0x2D, 0x34, 0x37, 0x3B, 0x2D, 0x3B, 
+  0x2E, 0x3B, 0x2F, 0x3B, 0x32, 0x3A, 0x33, 0x39, 0x33, 0x38, 0x34, 0x37, 0x34, 0x36, 0x17, 0x1D, 
+  0x16, 0x1F, 0x16, 0x20, 0x16, 0x22, 0x14, 0x23, 0x13, 0x24, 0x13, 0x24, 0x18, 0x23, 0x0C, 0x10, 
+  0x18, 0x23, 0x07, 0x10, 0x19, 0x22, 0x06, 0x10, 0x1A, 0x20, 0x05, 0x1F, 0x05, 0x1E, 0x05, 0x1E, 
+  0x05, 0x20, 0x2B, 0x2E, 0x05, 0x21, 0x23, 0x2F, 0x05, 0x2F, 0x06, 0x31, 0x39, 0x3B, 0x06, 0x32, 
+  0x38, 0x3B, 0x07, 0x33, 0x38, 0x3B, 0x08, 0x35, 0x37, 0x3B, 0x09, 0x0B, 0x0D, 0x3B, 0x0E, 0x3B, 
+  0x0F, 0x3B, 0x10, 0x3A, 0x11, 0x3B, 0x13, 0x27, 0x2D, 0x3B, 0x16, 0x19, 0x1B, 0x24, 0x2D, 0x3B, 
+  0x1D, 0x23, 0x2E, 0x3B, 0x2F, 0x3A, 0x31, 0x39, 0x32, 0x38, 0x32, 0x37, 0x33, 0x36, 0x1A, 0x1C, 
+  0x1A, 0x1C, 0x1A, 0x1C, 0x1A, 0x1C, 0x1A, 0x1C, 0x1A, 0x1C, 0x1A, 0x1C, 0x1A, 0x1C, 0x19, 0x1E, 
+  0x1A, 0x1E, 0x1A, 0x1E, 0x1A, 0x1E, 0x1A, 0x1E, 0x19, 0x1E, 0x18, 0x1E, 0x17, 0x1E, 0x17, 0x18, 
+  0x19, 0x1E, 0x17, 0x18, 0x19, 0x20, 0x38, 0x3B, 0x17, 0x18, 0x19, 0x21, 0x38, 0x3B, 0x17, 0x18, 
+  0x19, 0x22, 0x37, 0x3B, 0x17, 0x18, 0x19, 0x23, 0x37, 0x3B, 0x17, 0x18, 0x19, 0x23, 0x37, 0x3B, 
+  0x17, 0x18, 0x19, 0x23, 0x37, 0x3B, 0x17, 0x1F, 0x36, 0x3B, 0x16, 0x1E, 0x2D, 0x3B, 0x14, 0x1F, 
+  0x2B, 0x3B, 0x0E, 0x10, 0x12, 0x21, 0x27, 0x3B, 0x0D, 0x21, 0x25, 0x3B, 0x0B, 0x21, 0x23, 0x3B, 
+  0x08, 0x36, 0x06, 0x34, 0x06, 0x2F, 0x30, 0x32, 0x06, 0x2F, 0x06, 0x2D, 0x06, 0x2B, 0x06, 0x2A, 
+  0x07, 0x2C, 0x08, 0x2F, 0x09, 0x31, 0x0A, 0x0E, 0x0F, 0x31, 0x0C, 0x0D, 0x11, 0x32, 0x37, 0x39, 
+  0x11, 0x33, 0x36, 0x39, 0x12, 0x34, 0x36, 0x39, 0x12, 0x1F, 0x20, 0x24, 0x25, 0x35, 0x36, 0x3A, 
+  0x13, 0x1F, 0x27, 0x2B, 0x2D, 0x3A, 0x17, 0x1E, 0x2E, 0x3A, 0x2F, 0x3A, 0x30, 0x3A, 0x33, 0x3A, 
+  0x35, 0x3A, 0x37, 0x39, 0x1A, 0x1C, 0x19, 0x1D, 0x18, 0x1E, 0x18, 0x1E, 0x18, 0x1E, 0x19, 0x1D, 
+  0x1A, 0x1C, 0x1A, 0x1C, 0x1A, 0x1C, 0x1A, 0x1C, 0x1A, 0x1C, 0x19, 0x1E, 0x1A, 0x1E, 0x1A, 0x1E, 
+  0x1A, 0x1E, 0x1A, 0x1E, 0x19, 0x1E, 0x18, 0x1E, 0x17, 0x1E, 0x38, 0x3B, 0x17, 0x18, 0x19, 0x1E, 
+  0x38, 0x3B, 0x17, 0x18, 0x19, 0x20, 0x37, 0x3B, 0x17, 0x18, 0x19, 0x21, 0x37, 0x3B, 0x17, 0x18, 
+  0x19, 0x22, 0x37, 0x3B, 0x17, 0x23, 0x37, 0x3B, 0x16, 0x23, 0x36, 0x3B, 0x14, 0x23, 0x2D, 0x3B, 
+  0x12, 0x1F, 0x28, 0x3B, 0x11, 0x21, 0x25, 0x3B, 0x0E, 0x10, 0x11, 0x21, 0x23, 0x3B, 0x0D, 0x3B, 
+  0x0B, 0x36, 0x08, 0x34, 0x06, 0x2F, 0x30, 0x32, 0x06, 0x2F, 0x06, 0x2D, 0x06, 0x2B, 0x06, 0x2A, 
+  0x06, 0x2C, 0x07, 0x30, 0x08, 0x31, 0x09, 0x32, 0x0A, 0x0E, 0x0F, 0x32, 0x37, 0x39, 0x0C, 0x0D, 
+  0x11, 0x33, 0x36, 0x39, 0x11, 0x34, 0x36, 0x39, 0x12, 0x1F, 0x20, 0x35, 0x36, 0x3A, 0x12, 0x1F, 
+  0x25, 0x3A, 0x13, 0x1F, 0x27, 0x2B, 0x2D, 0x3A, 0x17, 0x1E, 0x2E, 0x3A, 0x2F, 0x3A, 0x32, 0x3A, 
+  0x34, 0x3A, 0x36, 0x39, 0x12, 0x15, 0x12, 0x16, 0x13, 0x17, 0x14, 0x19, 0x15, 0x1B, 0x15, 0x1C, 
+  0x16, 0x1D, 0x16, 0x1D, 0x17, 0x1E, 0x18, 0x1F, 0x19, 0x20, 0x19, 0x22, 0x19, 0x23, 0x19, 0x24, 
+  0x38, 0x3A, 0x19, 0x24, 0x37, 0x3A, 0x0F, 0x11, 0x18, 0x1D, 0x1E, 0x24, 0x37, 0x3A, 0x0A, 0x1D, 
+  0x1F, 0x24, 0x27, 0x34, 0x37, 0x3B, 0x09, 0x1D, 0x1E, 0x3B, 0x08, 0x3B, 0x08, 0x3B, 0x08, 0x3B, 
+  0x08, 0x3B, 0x08, 0x36, 0x39, 0x3B, 0x08, 0x2E, 0x30, 0x34, 0x09, 0x2D, 0x09, 0x2B, 0x0A, 0x28, 
+  0x0B, 0x0E, 0x0F, 0x2C, 0x11, 0x2D, 0x11, 0x2F, 0x13, 0x30, 0x14, 0x31, 0x1C, 0x31, 0x1F, 0x32, 
+  0x1F, 0x32, 0x26, 0x33, 0x28, 0x34, 0x2C, 0x35, 0x38, 0x3B, 0x2D, 0x36, 0x37, 0x3B, 0x2E, 0x3B, 
+  0x2F, 0x3B, 0x32, 0x3B, 0x32, 0x3A, 0x33, 0x39, 0x35, 0x37, 0x0F, 0x10, 0x0E, 0x11, 0x0E, 0x12, 
+  0x0F, 0x13, 0x16, 0x17, 0x10, 0x18, 0x11, 0x19, 0x12, 0x19, 0x12, 0x1A, 0x13, 0x1A, 0x13, 0x1A, 
+  0x13, 0x1C, 0x14, 0x20, 0x15, 0x20, 0x16, 0x20, 0x15, 0x21, 0x10, 0x21, 0x0B, 0x0E, 0x0F, 0x21, 
+  0x07, 0x1F, 0x39, 0x3B, 0x06, 0x2D, 0x38, 0x3B, 0x06, 0x30, 0x38, 0x3B, 0x05, 0x33, 0x35, 0x3B, 
+  0x05, 0x3B, 0x05, 0x3B, 0x05, 0x3B, 0x05, 0x3B, 0x06, 0x3B, 0x06, 0x2B, 0x2E, 0x32, 0x37, 0x3A, 
+  0x07, 0x2C, 0x09, 0x0B, 0x0D, 0x2E, 0x0F, 0x2F, 0x0F, 0x30, 0x10, 0x31, 0x11, 0x18, 0x1A, 0x32, 
+  0x37, 0x39, 0x1C, 0x33, 0x36, 0x3A, 0x1D, 0x3A, 0x1E, 0x22, 0x25, 0x2A, 0x2B, 0x3A, 0x2C, 0x3A, 
+  0x2E, 0x39, 0x31, 0x38, 0x32, 0x38, 0x34, 0x37, 0x10, 0x11, 0x0F, 0x12, 0x0F, 0x12, 0x10, 0x13, 
+  0x10, 0x14, 0x11, 0x18, 0x12, 0x19, 0x12, 0x19, 0x13, 0x19, 0x13, 0x19, 0x13, 0x19, 0x13, 0x1A, 
+  0x13, 0x1A, 0x13, 0x1F, 0x14, 0x1F, 0x14, 0x1F, 0x0F, 0x1D, 0x0B, 0x20, 0x06, 0x20, 0x05, 0x20, 
+  0x04, 0x25, 0x36, 0x38, 0x04, 0x27, 0x36, 0x39, 0x04, 0x29, 0x35, 0x39, 0x04, 0x2A, 0x35, 0x39, 
+  0x04, 0x2E, 0x34, 0x39, 0x04, 0x39, 0x04, 0x39, 0x05, 0x39, 0x06, 0x39, 0x07, 0x0A, 0x0B, 0x39, 
+  0x0C, 0x34, 0x0C, 0x32, 0x38, 0x3B, 0x0D, 0x2A, 0x2B, 0x33, 0x37, 0x3B, 0x0D, 0x28, 0x2C, 0x3B, 
+  0x0E, 0x25, 0x2D, 0x3B, 0x0F, 0x21, 0x2E, 0x3B, 0x10, 0x12, 0x1C, 0x20, 0x30, 0x3A, 0x32, 0x39, 
+  0x32, 0x38, 0x33, 0x37, 0x34, 0x36, 0x12, 0x15, 0x12, 0x16, 0x13, 0x16, 0x13, 0x17, 0x14, 0x17, 
+  0x14, 0x18, 0x15, 0x1B, 0x15, 0x1C, 0x15, 0x1C, 0x15, 0x1C, 0x15, 0x1C, 0x15, 0x1C, 0x16, 0x1C, 
+  0x16, 0x1D, 0x17, 0x1F, 0x17, 0x21, 0x17, 0x21, 0x0D, 0x0F, 0x10, 0x14, 0x15, 0x21, 0x07, 0x22, 
+  0x06, 0x22, 0x05, 0x22, 0x05, 0x29, 0x05, 0x2A, 0x2B, 0x2C, 0x05, 0x2F, 0x05, 0x30, 0x05, 0x30, 
+  0x06, 0x31, 0x06, 0x31, 0x38, 0x3B, 0x07, 0x32, 0x37, 0x3B, 0x08, 0x0B, 0x0C, 0x33, 0x36, 0x3B, 
+  0x0D, 0x33, 0x35, 0x3B, 0x0E, 0x3B, 0x0E, 0x3A, 0x0F, 0x3A, 0x0F, 0x2B, 0x2C, 0x3A, 0x10, 0x2A, 
+  0x2D, 0x39, 0x1C, 0x28, 0x30, 0x39, 0x1D, 0x21, 0x32, 0x38, 0x33, 0x37, 0x34, 0x36, 0x1A, 0x1C, 
+  0x1A, 0x1C, 0x1A, 0x1C, 0x1A, 0x1C, 0x1A, 0x1C, 0x1A, 0x1D, 0x17, 0x1E, 0x37, 0x3A, 0x15, 0x1E, 
+  0x37, 0x3B, 0x13, 0x1F, 0x36, 0x3B, 0x12, 0x1F, 0x2A, 0x3B, 0x11, 0x20, 0x26, 0x3B, 0x11, 0x21, 
+  0x23, 0x3B, 0x11, 0x3B, 0x0C, 0x3B, 0x0A, 0x35, 0x09, 0x34, 0x08, 0x32, 0x07, 0x2D, 0x07, 0x2B, 
+  0x07, 0x2A, 0x07, 0x29, 0x07, 0x26, 0x07, 0x28, 0x08, 0x29, 0x09, 0x2D, 0x0A, 0x0D, 0x0F, 0x2E, 
+  0x10, 0x31, 0x10, 0x32, 0x10, 0x34, 0x10, 0x1A, 0x1B, 0x35, 0x10, 0x1F, 0x20, 0x3B, 0x11, 0x1F, 
+  0x24, 0x3B, 0x12, 0x1F, 0x26, 0x3B, 0x13, 0x1F, 0x2E, 0x3B, 0x16, 0x1F, 0x30, 0x3B, 0x17, 0x1F, 
+  0x36, 0x3B, 0x18, 0x1F, 0x37, 0x3A, 0x1A, 0x1E, 0x1A, 0x1C, 0x19, 0x1D, 0x19, 0x1D, 0x19, 0x1D, 
+  0x19, 0x1D, 0x19, 0x1D, 0x1A, 0x1C, 0x1A, 0x1C, 0x15, 0x17, 0x1A, 0x1D, 0x37, 0x3A, 0x13, 0x1E, 
+  0x37, 0x3B, 0x12, 0x1E, 0x2D, 0x3B, 0x11, 0x1F, 0x2A, 0x3B, 0x11, 0x1F, 0x26, 0x3B, 0x11, 0x20, 
+  0x23, 0x3B, 0x11, 0x3B, 0x10, 0x3B, 0x0C, 0x35, 0x0A, 0x34, 0x09, 0x32, 0x08, 0x2E, 0x07, 0x2D, 
+  0x07, 0x2B, 0x07, 0x29, 0x07, 0x28, 0x07, 0x28, 0x07, 0x2A, 0x08, 0x2E, 0x09, 0x2F, 0x0A, 0x0D, 
+  0x0F, 0x32, 0x10, 0x33, 0x10, 0x34, 0x10, 0x35, 0x10, 0x1F, 0x20, 0x3A, 0x10, 0x1F, 0x24, 0x3B, 
+  0x11, 0x1F, 0x26, 0x3B, 0x12, 0x1F, 0x2E, 0x3B, 0x13, 0x1F, 0x30, 0x3B, 0x16, 0x1F, 0x36, 0x3B, 
+  0x17, 0x1F, 0x37, 0x3A, 0x18, 0x1F, 0x1A, 0x1E, 0x14, 0x17, 0x14, 0x17, 0x15, 0x18, 0x15, 0x18, 
+  0x16, 0x19, 0x16, 0x1A, 0x17, 0x1D, 0x17, 0x1D, 0x18, 0x1D, 0x18, 0x1D, 0x14, 0x1E, 0x13, 0x1E, 
+  0x12, 0x1E, 0x12, 0x1E, 0x11, 0x29, 0x11, 0x2B, 0x0D, 0x10, 0x11, 0x34, 0x0C, 0x3A, 0x0B, 0x3A, 
+  0x0A, 0x3A, 0x09, 0x3A, 0x09, 0x3A, 0x09, 0x37, 0x09, 0x3A, 0x0A, 0x3B, 0x0A, 0x3B, 0x0B, 0x3B, 
+  0x0C, 0x3B, 0x0D, 0x10, 0x12, 0x31, 0x36, 0x3B, 0x12, 0x30, 0x12, 0x2E, 0x12, 0x2C, 0x13, 0x21, 
+  0x23, 0x28, 0x13, 0x20, 0x14, 0x20, 0x1D, 0x1F, 0x0F, 0x11, 0x0F, 0x12, 0x10, 0x12, 0x10, 0x13, 
+  0x11, 0x13, 0x16, 0x19, 0x11, 0x1A, 0x12, 0x1B, 0x12, 0x1B, 0x10, 0x1B, 0x0F, 0x1B, 0x0E, 0x1A, 
+  0x22, 0x25, 0x0E, 0x1A, 0x1F, 0x2A, 0x0D, 0x32, 0x37, 0x3B, 0x0D, 0x3B, 0x09, 0x0C, 0x0D, 0x3B, 
+  0x08, 0x3B, 0x07, 0x3B, 0x06, 0x3B, 0x05, 0x32, 0x05, 0x2A, 0x05, 0x25, 0x29, 0x2F, 0x05, 0x38, 
+  0x06, 0x39, 0x06, 0x39, 0x07, 0x39, 0x08, 0x39, 0x09, 0x0C, 0x0E, 0x32, 0x34, 0x38, 0x0E, 0x30, 
+  0x0E, 0x2B, 0x0E, 0x27, 0x28, 0x2A, 0x0F, 0x1E, 0x0F, 0x1D, 0x10, 0x1D, 0x14, 0x1C, 0x19, 0x1B, 
+  0x12, 0x13, 0x11, 0x14, 0x11, 0x14, 0x12, 0x15, 0x18, 0x1A, 0x12, 0x1B, 0x10, 0x1B, 0x0F, 0x1B, 
+  0x0E, 0x1B, 0x0E, 0x1B, 0x20, 0x27, 0x0E, 0x1E, 0x1F, 0x2B, 0x0D, 0x31, 0x09, 0x0C, 0x0D, 0x32, 
+  0x33, 0x36, 0x07, 0x3B, 0x06, 0x3B, 0x05, 0x3B, 0x05, 0x3B, 0x05, 0x3B, 0x05, 0x31, 0x05, 0x25, 
+  0x05, 0x2C, 0x2D, 0x32, 0x35, 0x39, 0x06, 0x39, 0x07, 0x39, 0x08, 0x39, 0x09, 0x0C, 0x0D, 0x39, 
+  0x0D, 0x34, 0x35, 0x39, 0x0D, 0x32, 0x0D, 0x17, 0x18, 0x2B, 0x0D, 0x26, 0x0D, 0x21, 0x0E, 0x21, 
+  0x0F, 0x21, 0x13, 0x20, 0x15, 0x1E, 0x18, 0x1B, 0x12, 0x14, 0x12, 0x15, 0x13, 0x15, 0x13, 0x15, 
+  0x13, 0x16, 0x14, 0x16, 0x17, 0x1A, 0x14, 0x1B, 0x11, 0x1B, 0x0F, 0x1B, 0x0E, 0x1B, 0x0E, 0x1A, 
+  0x21, 0x25, 0x0D, 0x1A, 0x1B, 0x27, 0x28, 0x2B, 0x0D, 0x2F, 0x0A, 0x0B, 0x0D, 0x32, 0x08, 0x0C, 
+  0x0D, 0x39, 0x06, 0x3A, 0x06, 0x3A, 0x05, 0x3A, 0x05, 0x39, 0x05, 0x31, 0x05, 0x25, 0x2C, 0x30, 
+  0x38, 0x3B, 0x05, 0x33, 0x35, 0x3B, 0x05, 0x3B, 0x06, 0x3B, 0x07, 0x3B, 0x08, 0x3B, 0x09, 0x0C, 
+  0x0D, 0x34, 0x36, 0x3B, 0x0D, 0x32, 0x0D, 0x17, 0x19, 0x2C, 0x0D, 0x27, 0x0E, 0x21, 0x0E, 0x1F, 
+  0x0F, 0x1D, 0x13, 0x1C, 0x19, 0x1B, 0x14, 0x17, 0x13, 0x19, 0x1D, 0x20, 0x23, 0x29, 0x12, 0x2C, 
+  0x12, 0x34, 0x36, 0x39, 0x11, 0x39, 0x0D, 0x0E, 0x11, 0x39, 0x0C, 0x0F, 0x11, 0x39, 0x0B, 0x39, 
+  0x0A, 0x34, 0x36, 0x39, 0x09, 0x30, 0x36, 0x3B, 0x08, 0x2C, 0x2F, 0x35, 0x36, 0x3B, 0x08, 0x3B, 
+  0x08, 0x3B, 0x08, 0x3B, 0x08, 0x3B, 0x09, 0x3B, 0x0A, 0x34, 0x38, 0x3B, 0x0B, 0x32, 0x38, 0x3B, 
+  0x0D, 0x0F, 0x11, 0x31, 0x39, 0x3B, 0x11, 0x2A, 0x2D, 0x30, 0x3A, 0x3B, 0x11, 0x22, 0x25, 0x29, 
+  0x12, 0x22, 0x13, 0x22, 0x18, 0x21, 0x1A, 0x20, 0x1B, 0x1F, 0x14, 0x17, 0x1D, 0x20, 0x23, 0x29, 
+  0x13, 0x2C, 0x12, 0x34, 0x36, 0x39, 0x12, 0x39, 0x11, 0x39, 0x0C, 0x0E, 0x11, 0x39, 0x0B, 0x39, 
+  0x0A, 0x34, 0x36, 0x39, 0x09, 0x30, 0x35, 0x3A, 0x08, 0x2C, 0x30, 0x3B, 0x08, 0x3B, 0x08, 0x3B, 
+  0x08, 0x3B, 0x08, 0x3B, 0x09, 0x3B, 0x0A, 0x34, 0x38, 0x3B, 0x0B, 0x33, 0x38, 0x3B, 0x0D, 0x0F, 
+  0x11, 0x32, 0x39, 0x3B, 0x11, 0x2A, 0x2E, 0x31, 0x3A, 0x3B, 0x12, 0x22, 0x25, 0x29, 0x13, 0x22, 
+  0x18, 0x22, 0x1A, 0x20, 0x1B, 0x1F, 
+};
+
+static const u16 g_player_span_index_mip1[871] = {
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0001, 0x0002, 0x0003, 0x0005, 0x0006, 0x0007, 0x0008, 
+  0x0009, 0x000A, 0x000B, 0x000C, 0x000E, 0x0010, 0x0011, 0x0012, 0x0013, 0x0014, 0x0015, 0x0016, 
+  0x0017, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0019, 
+  0x001A, 0x001B, 0x001D, 0x001F, 0x0020, 0x0021, 0x0022, 0x0023, 0x0025, 0x0026, 0x0028, 0x002A, 
+  0x002C, 0x002D, 0x002E, 0x0030, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 
+  0x0031, 0x0031, 0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037, 0x0038, 0x0039, 0x003A, 
+  0x003B, 0x003C, 0x003D, 0x003F, 0x0040, 0x0041, 0x0042, 0x0044, 0x0045, 0x0046, 0x0047, 0x0047, 
+  0x0047, 0x0047, 0x0047, 0x0047, 0x0047, 0x0047, 0x0047, 0x0047, 0x0048, 0x0049, 0x004A, 0x004B, 
+  0x004C, 0x004D, 0x004E, 0x004F, 0x0050, 0x0051, 0x0052, 0x0053, 0x0055, 0x0056, 0x0057, 0x0058, 
+  0x0059, 0x005A, 0x005B, 0x005C, 0x005C, 0x005C, 0x005C, 0x005C, 0x005C, 0x005C, 0x005C, 0x005C, 
+  0x005C, 0x005C, 0x005C, 0x005C, 0x005D, 0x005E, 0x005F, 0x0061, 0x0063, 0x0065, 0x0066, 0x0067, 
+  0x0068, 0x006A, 0x006B, 0x006C, 0x006E, 0x0070, 0x0070, 0x0070, 0x0070, 0x0070, 0x0070, 0x0070, 
+  0x0070, 0x0070, 0x0070, 0x0070, 0x0070, 0x0070, 0x0070, 0x0070, 0x0070, 0x0071, 0x0072, 0x0073, 
+  0x0075, 0x0077, 0x0079, 0x007A, 0x007B, 0x007C, 0x007F, 0x0080, 0x0081, 0x0083, 0x0086, 0x0086, 
+  0x0086, 0x0086, 0x0086, 0x0086, 0x0086, 0x0086, 0x0086, 0x0086, 0x0086, 0x0086, 0x0086, 0x0086, 
+  0x0086, 0x0087, 0x0088, 0x0089, 0x008A, 0x008B, 0x008C, 0x008E, 0x0090, 0x0091, 0x0092, 0x0093, 
+  0x0095, 0x0096, 0x0098, 0x009A, 0x009C, 0x009E, 0x009E, 0x009E, 0x009E, 0x009E, 0x009E, 0x009E, 
+  0x009E, 0x009E, 0x009E, 0x009E, 0x009E, 0x009E, 0x009F, 0x00A0, 0x00A1, 0x00A3, 0x00A4, 0x00A6, 
+  0x00A7, 0x00A8, 0x00A9, 0x00AB, 0x00AD, 0x00AE, 0x00AF, 0x00B0, 0x00B3, 0x00B4, 0x00B5, 0x00B5, 
+  0x00B5, 0x00B5, 0x00B5, 0x00B5, 0x00B5, 0x00B5, 0x00B5, 0x00B5, 0x00B5, 0x00B5, 0x00B6, 0x00B7, 
+  0x00B8, 0x00B9, 0x00BA, 0x00BC, 0x00BF, 0x00C0, 0x00C1, 0x00C2, 0x00C3, 0x00C4, 0x00C5, 0x00C6, 
+  0x00C8, 0x00CA, 0x00CC, 0x00CD, 0x00CE, 0x00CE, 0x00CE, 0x00CE, 0x00CE, 0x00CE, 0x00CE, 0x00CE, 
+  0x00CE, 0x00CE, 0x00CE, 0x00CE, 0x00CF, 0x00D0, 0x00D1, 0x00D2, 0x00D3, 0x00D4, 0x00D5, 0x00D7, 
+  0x00D8, 0x00D9, 0x00DA, 0x00DC, 0x00DD, 0x00DE, 0x00E1, 0x00E3, 0x00E5, 0x00E5, 0x00E5, 0x00E5, 
+  0x00E5, 0x00E5, 0x00E5, 0x00E5, 0x00E5, 0x00E5, 0x00E5, 0x00E6, 0x00E7, 0x00E8, 0x00E9, 0x00EA, 
+  0x00EB, 0x00EC, 0x00ED, 0x00EE, 0x00EF, 0x00F1, 0x00F3, 0x00F6, 0x00F8, 0x00F9, 0x00FA, 0x00FB, 
+  0x00FC, 0x00FE, 0x0100, 0x0102, 0x0102, 0x0102, 0x0102, 0x0102, 0x0102, 0x0102, 0x0102, 0x0103, 
+  0x0104, 0x0105, 0x0106, 0x0107, 0x0108, 0x0109, 0x010A, 0x010B, 0x010C, 0x010D, 0x010E, 0x0110, 
+  0x0113, 0x0115, 0x0116, 0x0117, 0x0118, 0x011A, 0x011B, 0x011D, 0x0120, 0x0122, 0x0122, 0x0122, 
+  0x0122, 0x0122, 0x0122, 0x0122, 0x0123, 0x0124, 0x0125, 0x0127, 0x012B, 0x012E, 0x0131, 0x0133, 
+  0x0134, 0x0135, 0x0137, 0x0139, 0x013A, 0x013B, 0x013C, 0x013E, 0x013F, 0x0141, 0x0142, 0x0143, 
+  0x0144, 0x0145, 0x0145, 0x0145, 0x0145, 0x0145, 0x0145, 0x0145, 0x0145, 0x0145, 0x0145, 0x0146, 
+  0x0147, 0x0148, 0x0149, 0x014B, 0x014D, 0x014F, 0x0151, 0x0152, 0x0153, 0x0154, 0x0156, 0x0159, 
+  0x015B, 0x015C, 0x015D, 0x015E, 0x015F, 0x015F, 0x015F, 0x015F, 0x015F, 0x015F, 0x015F, 0x015F, 
+  0x015F, 0x015F, 0x015F, 0x0160, 0x0161, 0x0162, 0x0164, 0x0167, 0x016B, 0x016E, 0x016F, 0x0170, 
+  0x0171, 0x0172, 0x0173, 0x0174, 0x0175, 0x0177, 0x0178, 0x0179, 0x017A, 0x017B, 0x017C, 0x017C, 
+  0x017C, 0x017C, 0x017C, 0x017C, 0x017C, 0x017C, 0x017C, 0x017C, 0x017C, 0x017D, 0x017E, 0x017F, 
+  0x0180, 0x0182, 0x0184, 0x0185, 0x0187, 0x0188, 0x018A, 0x018C, 0x018D, 0x018E, 0x018F, 0x0192, 
+  0x0193, 0x0194, 0x0195, 0x0195, 0x0195, 0x0195, 0x0195, 0x0195, 0x0195, 0x0195, 0x0196, 0x0197, 
+  0x0198, 0x0199, 0x019A, 0x019B, 0x019C, 0x019D, 0x019E, 0x01A0, 0x01A2, 0x01A4, 0x01A6, 0x01A9, 
+  0x01AB, 0x01AC, 0x01AD, 0x01AE, 0x01AF, 0x01B0, 0x01B2, 0x01B4, 0x01B6, 0x01B8, 0x01B9, 0x01BA, 
+  0x01BA, 0x01BA, 0x01BA, 0x01BB, 0x01BC, 0x01BD, 0x01BE, 0x01BF, 0x01C0, 0x01C1, 0x01C2, 0x01C3, 
+  0x01C5, 0x01C7, 0x01C9, 0x01CB, 0x01CD, 0x01CE, 0x01CF, 0x01D0, 0x01D1, 0x01D2, 0x01D3, 0x01D4, 
+  0x01D6, 0x01D7, 0x01DA, 0x01DB, 0x01DC, 0x01DC, 0x01DC, 0x01DC, 0x01DC, 0x01DC, 0x01DD, 0x01DE, 
+  0x01DF, 0x01E0, 0x01E1, 0x01E2, 0x01E4, 0x01E6, 0x01E7, 0x01E8, 0x01E9, 0x01EB, 0x01EC, 0x01ED, 
+  0x01EE, 0x01EF, 0x01F0, 0x01F1, 0x01F3, 0x01F4, 0x01F5, 0x01F6, 0x01F6, 0x01F6, 0x01F6, 0x01F6, 
+  0x01F6, 0x01F6, 0x01F6, 0x01F6, 0x01F7, 0x01F8, 0x01F9, 0x01FA, 0x01FB, 0x01FC, 0x01FD, 0x01FE, 
+  0x0200, 0x0202, 0x0203, 0x0204, 0x0205, 0x0208, 0x0209, 0x020A, 0x020D, 0x020E, 0x020F, 0x0210, 
+  0x0211, 0x0211, 0x0211, 0x0211, 0x0211, 0x0211, 0x0211, 0x0211, 0x0211, 0x0212, 0x0213, 0x0214, 
+  0x0215, 0x0216, 0x0217, 0x0218, 0x0219, 0x021A, 0x021B, 0x021D, 0x021F, 0x0220, 0x0221, 0x0222, 
+  0x0224, 0x0226, 0x0228, 0x022B, 0x022C, 0x022D, 0x022D, 0x022D, 0x022D, 0x022D, 0x022D, 0x022D, 
+  0x022D, 0x022D, 0x022E, 0x022F, 0x0230, 0x0231, 0x0232, 0x0233, 0x0234, 0x0235, 0x0237, 0x0238, 
+  0x0239, 0x023A, 0x023B, 0x023D, 0x023F, 0x0240, 0x0241, 0x0243, 0x0245, 0x0246, 0x0246, 0x0246, 
+  0x0246, 0x0246, 0x0246, 0x0246, 0x0246, 0x0246, 0x0246, 0x0247, 0x0248, 0x0249, 0x024B, 0x024D, 
+  0x024F, 0x0250, 0x0251, 0x0252, 0x0253, 0x0254, 0x0255, 0x0256, 0x0258, 0x0259, 0x025A, 0x025C, 
+  0x025E, 0x0260, 0x0261, 0x0261, 0x0261, 0x0261, 0x0261, 0x0261, 0x0261, 0x0261, 0x0261, 0x0261, 
+  0x0262, 0x0263, 0x0264, 0x0265, 0x0267, 0x0269, 0x026B, 0x026C, 0x026D, 0x026E, 0x026F, 0x0270, 
+  0x0271, 0x0272, 0x0274, 0x0275, 0x0276, 0x0278, 0x027A, 0x027C, 0x027D, 0x027D, 0x027D, 0x027D, 
+  0x027D, 0x027D, 0x027D, 0x027D, 0x027D, 0x027D, 0x027E, 0x027F, 0x0280, 0x0281, 0x0282, 0x0283, 
+  0x0284, 0x0285, 0x0286, 0x0287, 0x0288, 0x0289, 0x028A, 0x028B, 0x028E, 0x028F, 0x0291, 0x0292, 
+  0x0292, 0x0292, 0x0292, 0x0292, 0x0292, 0x0292, 0x0292, 0x0292, 0x0292, 0x0292, 0x0292, 0x0292, 
+  0x0293, 0x0295, 0x0296, 0x0297, 0x0299, 0x029B, 0x029C, 0x029D, 0x029E, 0x029F, 0x02A0, 0x02A1, 
+  0x02A2, 0x02A3, 0x02A5, 0x02A6, 0x02A7, 0x02A7, 0x02A7, 0x02A7, 0x02A7, 0x02A7, 0x02A7, 0x02A7, 
+  0x02A7, 0x02A7, 0x02A7, 0x02A7, 0x02A7, 0x02A8, 0x02A9, 0x02AA, 0x02AC, 0x02AD, 0x02AE, 0x02AF, 
+  0x02B0, 0x02B1, 0x02B2, 0x02B3, 0x02B4, 0x02B5, 0x02B6, 0x02B7, 0x02B8, 0x02B9, 0x02B9, 0x02B9, 
+  0x02B9, 0x02B9, 0x02B9, 0x02B9, 0x02B9, 0x02B9, 0x02B9, 0x02B9, 0x02B9, 0x02BA, 0x02BB, 0x02BC, 
+  0x02BD, 0x02BE, 0x02C0, 0x02C1, 0x02C2, 0x02C3, 0x02C4, 0x02C6, 0x02C7, 0x02C8, 0x02C9, 0x02CA, 
+  0x02CB, 0x02CC, 0x02CD, 0x02CD, 0x02CD, 0x02CD, 0x02CD, 0x02CD, 0x02CD, 0x02CD, 0x02CD, 0x02CD, 
+  0x02CD, 0x02CD, 0x02CD, 0x02CD, 0x02CE, 0x02CF, 0x02D0, 0x02D2, 0x02D3, 0x02D5, 0x02D6, 0x02D7, 
+  0x02D8, 0x02DA, 0x02DD, 0x02DE, 0x02DF, 0x02E0, 0x02E0, 0x02E0, 0x02E0, 0x02E0, 0x02E0, 0x02E0, 
+  0x02E0, 0x02E0, 0x02E0, 0x02E0, 0x02E0, 0x02E0, 0x02E0, 0x02E0, 0x02E0, 0x02E0, 0x02E1, 0x02E2, 
+  0x02E4, 0x02E5, 0x02E6, 0x02E7, 0x02E8, 0x02E9, 0x02EB, 0x02EE, 0x02EF, 0x02F0, 0x02F0, 0x02F0, 
+  0x02F0, 0x02F0, 0x02F0, 0x02F0, 0x02F0, 0x02F0, 0x02F0, 
+};
+static const u8 g_player_spans_mip1[1504] = {
+  0x08, 0x0E, 0x07, 0x0F, 0x06, 0x10, 0x04, 0x05, 0x06, 0x14, 0x03, 0x16, 0x02, 0x17, 0x02, 0x1B, 
+  0x01, 0x1D, 0x02, 0x1E, 0x02, 0x1E, 0x03, 0x1E, 0x06, 0x16, 0x17, 0x19, 0x06, 0x0D, 0x10, 0x12, 
+  0x07, 0x0D, 0x09, 0x0D, 0x08, 0x0D, 0x08, 0x0C, 0x08, 0x0A, 0x07, 0x09, 0x07, 0x09, 0x07, 0x08, 
+  0x0B, 0x0E, 0x08, 0x10, 0x07, 0x11, 0x07, 0x13, 0x14, 0x15, 0x04, 0x05, 0x07, 0x17, 0x03, 0x18, 
+  0x02, 0x1C, 0x01, 0x1D, 0x01, 0x1C, 0x02, 0x1A, 0x1B, 0x1E, 0x03, 0x1E, 0x04, 0x05, 0x06, 0x1E, 
+  0x07, 0x1A, 0x1B, 0x1E, 0x07, 0x0D, 0x11, 0x13, 0x08, 0x0E, 0x07, 0x0D, 0x07, 0x09, 0x0A, 0x0C, 
+  0x06, 0x08, 0x0C, 0x0E, 0x08, 0x10, 0x07, 0x11, 0x06, 0x13, 0x06, 0x19, 0x04, 0x1E, 0x03, 0x1E, 
+  0x02, 0x1E, 0x01, 0x1D, 0x01, 0x1C, 0x02, 0x1C, 0x03, 0x18, 0x06, 0x0E, 0x10, 0x15, 0x07, 0x0D, 
+  0x07, 0x0E, 0x08, 0x0D, 0x08, 0x0A, 0x0B, 0x0D, 0x07, 0x09, 0x07, 0x09, 0x07, 0x08, 0x0A, 0x0E, 
+  0x07, 0x10, 0x06, 0x13, 0x06, 0x19, 0x06, 0x1E, 0x04, 0x1E, 0x03, 0x1E, 0x02, 0x1C, 0x02, 0x1D, 
+  0x02, 0x1C, 0x03, 0x18, 0x04, 0x17, 0x07, 0x0E, 0x10, 0x13, 0x07, 0x0E, 0x08, 0x0E, 0x0A, 0x0E, 
+  0x0A, 0x0D, 0x0A, 0x0B, 0x09, 0x0B, 0x09, 0x0B, 0x0D, 0x0F, 0x0B, 0x10, 0x08, 0x10, 0x04, 0x06, 
+  0x07, 0x13, 0x03, 0x17, 0x1B, 0x1C, 0x02, 0x18, 0x1A, 0x1C, 0x01, 0x1C, 0x02, 0x1C, 0x02, 0x1C, 
+  0x04, 0x1B, 0x1C, 0x1E, 0x06, 0x1E, 0x07, 0x1E, 0x07, 0x0F, 0x10, 0x1E, 0x09, 0x0A, 0x11, 0x13, 
+  0x0D, 0x0F, 0x0B, 0x10, 0x08, 0x10, 0x04, 0x06, 0x07, 0x14, 0x03, 0x18, 0x1B, 0x1C, 0x02, 0x18, 
+  0x1A, 0x1C, 0x01, 0x1C, 0x02, 0x1C, 0x02, 0x1B, 0x04, 0x18, 0x19, 0x1A, 0x1C, 0x1E, 0x06, 0x1E, 
+  0x07, 0x1E, 0x07, 0x0C, 0x0E, 0x1E, 0x11, 0x15, 0x17, 0x19, 0x1C, 0x1D, 0x0E, 0x10, 0x0E, 0x11, 
+  0x0C, 0x11, 0x09, 0x11, 0x08, 0x11, 0x04, 0x11, 0x03, 0x13, 0x1C, 0x1E, 0x02, 0x15, 0x1B, 0x1E, 
+  0x02, 0x1E, 0x03, 0x1E, 0x04, 0x1E, 0x05, 0x06, 0x07, 0x1A, 0x07, 0x18, 0x07, 0x13, 0x15, 0x1C, 
+  0x07, 0x0E, 0x16, 0x1C, 0x08, 0x0E, 0x17, 0x1B, 0x0B, 0x0D, 0x18, 0x1A, 0x0E, 0x10, 0x0C, 0x11, 
+  0x0C, 0x11, 0x09, 0x0A, 0x0B, 0x11, 0x08, 0x11, 0x05, 0x07, 0x08, 0x11, 0x03, 0x13, 0x02, 0x17, 
+  0x02, 0x18, 0x02, 0x18, 0x1C, 0x1E, 0x03, 0x1A, 0x1B, 0x1E, 0x04, 0x1E, 0x07, 0x1E, 0x06, 0x1D, 
+  0x07, 0x0F, 0x11, 0x13, 0x19, 0x1B, 0x08, 0x0E, 0x0B, 0x0D, 0x0E, 0x10, 0x0D, 0x11, 0x0C, 0x11, 
+  0x0B, 0x11, 0x0A, 0x11, 0x08, 0x11, 0x1C, 0x1E, 0x06, 0x14, 0x15, 0x17, 0x1C, 0x1E, 0x03, 0x1E, 
+  0x02, 0x1E, 0x02, 0x1E, 0x02, 0x19, 0x03, 0x15, 0x04, 0x17, 0x07, 0x18, 0x07, 0x19, 0x1C, 0x1D, 
+  0x07, 0x0F, 0x11, 0x1D, 0x08, 0x0E, 0x16, 0x1D, 0x18, 0x1C, 0x1A, 0x1B, 0x0E, 0x10, 0x0D, 0x11, 
+  0x0C, 0x10, 0x09, 0x11, 0x08, 0x11, 0x04, 0x13, 0x03, 0x17, 0x02, 0x19, 0x1C, 0x1E, 0x02, 0x1E, 
+  0x02, 0x1E, 0x03, 0x1D, 0x04, 0x18, 0x1A, 0x1C, 0x07, 0x19, 0x07, 0x1D, 0x07, 0x0E, 0x0F, 0x13, 
+  0x16, 0x1D, 0x08, 0x0E, 0x18, 0x1C, 0x0B, 0x0D, 0x19, 0x1A, 0x0C, 0x0E, 0x0C, 0x0E, 0x0C, 0x0E, 
+  0x0C, 0x0F, 0x0C, 0x0F, 0x0B, 0x0F, 0x0B, 0x0F, 0x0B, 0x10, 0x0B, 0x11, 0x0B, 0x11, 0x0B, 0x10, 
+  0x1D, 0x1E, 0x0C, 0x10, 0x1C, 0x1E, 0x04, 0x08, 0x09, 0x0F, 0x1B, 0x1E, 0x03, 0x13, 0x15, 0x1E, 
+  0x02, 0x1E, 0x02, 0x1E, 0x02, 0x1E, 0x03, 0x1D, 0x05, 0x06, 0x08, 0x1D, 0x09, 0x13, 0x17, 0x1D, 
+  0x0E, 0x11, 0x1A, 0x1D, 0x0C, 0x0E, 0x0B, 0x0F, 0x0C, 0x0E, 0x0C, 0x0E, 0x0C, 0x0E, 0x0C, 0x0F, 
+  0x0C, 0x0F, 0x0B, 0x0F, 0x0B, 0x0F, 0x0B, 0x10, 0x0B, 0x11, 0x0B, 0x11, 0x0B, 0x10, 0x1C, 0x1E, 
+  0x06, 0x07, 0x0C, 0x10, 0x1C, 0x1E, 0x04, 0x11, 0x1B, 0x1E, 0x02, 0x1E, 0x02, 0x1E, 0x02, 0x1E, 
+  0x03, 0x1A, 0x1B, 0x1E, 0x04, 0x1D, 0x08, 0x14, 0x17, 0x1D, 0x0C, 0x0D, 0x0E, 0x12, 0x18, 0x1C, 
+  0x10, 0x11, 0x1A, 0x1C, 0x0C, 0x0F, 0x0A, 0x11, 0x09, 0x12, 0x08, 0x12, 0x1D, 0x1E, 0x07, 0x08, 
+  0x0C, 0x0E, 0x0F, 0x12, 0x1C, 0x1E, 0x04, 0x09, 0x0C, 0x11, 0x1B, 0x1E, 0x03, 0x10, 0x16, 0x19, 
+  0x1B, 0x1E, 0x03, 0x10, 0x12, 0x1E, 0x03, 0x1E, 0x03, 0x1E, 0x04, 0x17, 0x18, 0x19, 0x05, 0x06, 
+  0x07, 0x15, 0x08, 0x16, 0x09, 0x17, 0x0F, 0x18, 0x10, 0x11, 0x13, 0x19, 0x15, 0x19, 0x16, 0x19, 
+  0x1B, 0x1D, 0x17, 0x1D, 0x18, 0x1D, 0x19, 0x1C, 0x19, 0x1A, 0x0A, 0x10, 0x09, 0x11, 0x07, 0x11, 
+  0x07, 0x10, 0x05, 0x08, 0x0A, 0x10, 0x03, 0x08, 0x09, 0x0F, 0x02, 0x14, 0x1C, 0x1E, 0x02, 0x18, 
+  0x1B, 0x1E, 0x02, 0x1E, 0x03, 0x1E, 0x04, 0x1D, 0x07, 0x19, 0x1B, 0x1D, 0x08, 0x11, 0x12, 0x19, 
+  0x1B, 0x1C, 0x15, 0x19, 0x1A, 0x1D, 0x16, 0x1D, 0x17, 0x1C, 0x19, 0x1C, 0x1A, 0x1B, 0x0B, 0x0E, 
+  0x08, 0x11, 0x08, 0x12, 0x0B, 0x0E, 0x0F, 0x11, 0x06, 0x08, 0x0C, 0x10, 0x1C, 0x1D, 0x04, 0x08, 
+  0x0A, 0x0B, 0x0C, 0x10, 0x1B, 0x1D, 0x02, 0x0F, 0x15, 0x17, 0x1B, 0x1D, 0x02, 0x1D, 0x02, 0x1D, 
+  0x03, 0x1D, 0x04, 0x19, 0x08, 0x18, 0x09, 0x18, 0x0E, 0x19, 0x15, 0x1A, 0x1C, 0x1E, 0x16, 0x1E, 
+  0x17, 0x1E, 0x19, 0x1D, 0x1A, 0x1C, 0x1A, 0x1B, 0x0C, 0x0E, 0x0B, 0x10, 0x0A, 0x11, 0x09, 0x12, 
+  0x06, 0x08, 0x0C, 0x12, 0x03, 0x08, 0x0D, 0x11, 0x02, 0x0F, 0x02, 0x10, 0x16, 0x17, 0x02, 0x18, 
+  0x03, 0x19, 0x1C, 0x1E, 0x04, 0x1A, 0x1C, 0x1E, 0x07, 0x1E, 0x08, 0x1E, 0x09, 0x1E, 0x0B, 0x0C, 
+  0x0E, 0x12, 0x17, 0x1E, 0x18, 0x1D, 0x19, 0x1C, 0x1A, 0x1B, 0x0D, 0x0E, 0x0D, 0x0E, 0x0D, 0x0E, 
+  0x0D, 0x0E, 0x0D, 0x0F, 0x0D, 0x0F, 0x0D, 0x0F, 0x0C, 0x0F, 0x0B, 0x0F, 0x0B, 0x10, 0x1C, 0x1E, 
+  0x0B, 0x11, 0x1B, 0x1E, 0x0B, 0x12, 0x1B, 0x1E, 0x0B, 0x0F, 0x17, 0x1E, 0x07, 0x08, 0x09, 0x10, 
+  0x14, 0x1E, 0x06, 0x11, 0x12, 0x1E, 0x03, 0x1B, 0x03, 0x19, 0x03, 0x16, 0x03, 0x16, 0x04, 0x18, 
+  0x05, 0x07, 0x08, 0x19, 0x09, 0x1A, 0x1B, 0x1D, 0x09, 0x12, 0x13, 0x1D, 0x0C, 0x0F, 0x17, 0x1D, 
+  0x18, 0x1D, 0x1B, 0x1D, 0x0D, 0x0E, 0x0C, 0x0F, 0x0C, 0x0F, 0x0D, 0x0E, 0x0D, 0x0E, 0x0D, 0x0F, 
+  0x0D, 0x0F, 0x0D, 0x0F, 0x0C, 0x0F, 0x0B, 0x0F, 0x1C, 0x1E, 0x0B, 0x10, 0x1B, 0x1E, 0x0B, 0x11, 
+  0x1B, 0x1E, 0x0A, 0x12, 0x17, 0x1E, 0x09, 0x10, 0x13, 0x1E, 0x07, 0x1E, 0x04, 0x1B, 0x03, 0x19, 
+  0x03, 0x16, 0x03, 0x16, 0x04, 0x18, 0x05, 0x19, 0x08, 0x1A, 0x1B, 0x1D, 0x09, 0x1D, 0x0A, 0x0F, 
+  0x14, 0x15, 0x17, 0x1D, 0x18, 0x1D, 0x1A, 0x1D, 0x09, 0x0B, 0x0A, 0x0C, 0x0A, 0x0E, 0x0B, 0x0F, 
+  0x0C, 0x0F, 0x0C, 0x11, 0x0C, 0x12, 0x1C, 0x1D, 0x0C, 0x12, 0x1B, 0x1D, 0x05, 0x1E, 0x04, 0x1E, 
+  0x04, 0x1E, 0x04, 0x1B, 0x1D, 0x1E, 0x04, 0x16, 0x05, 0x16, 0x08, 0x17, 0x0A, 0x18, 0x0E, 0x19, 
+  0x10, 0x19, 0x14, 0x1A, 0x1C, 0x1E, 0x17, 0x1E, 0x18, 0x1E, 0x19, 0x1D, 0x07, 0x08, 0x07, 0x09, 
+  0x08, 0x0C, 0x09, 0x0D, 0x09, 0x0D, 0x0A, 0x10, 0x0B, 0x10, 0x08, 0x11, 0x04, 0x10, 0x1D, 0x1E, 
+  0x03, 0x18, 0x1C, 0x1E, 0x02, 0x1E, 0x02, 0x1E, 0x03, 0x1E, 0x03, 0x16, 0x17, 0x19, 0x1C, 0x1D, 
+  0x07, 0x17, 0x08, 0x18, 0x09, 0x0C, 0x0D, 0x19, 0x1B, 0x1D, 0x0F, 0x1D, 0x16, 0x1D, 0x19, 0x1C, 
+  0x1A, 0x1B, 0x08, 0x09, 0x08, 0x09, 0x08, 0x0C, 0x09, 0x0D, 0x09, 0x0D, 0x09, 0x0D, 0x09, 0x0F, 
+  0x0A, 0x10, 0x06, 0x10, 0x03, 0x10, 0x02, 0x13, 0x1B, 0x1C, 0x02, 0x15, 0x1A, 0x1D, 0x02, 0x1D, 
+  0x02, 0x1D, 0x03, 0x1D, 0x06, 0x1A, 0x1C, 0x1E, 0x06, 0x15, 0x16, 0x1E, 0x07, 0x12, 0x17, 0x1E, 
+  0x08, 0x09, 0x0E, 0x10, 0x18, 0x1D, 0x19, 0x1C, 0x1A, 0x1B, 0x09, 0x0B, 0x09, 0x0B, 0x0A, 0x0C, 
+  0x0A, 0x0E, 0x0A, 0x0E, 0x0A, 0x0E, 0x0B, 0x0E, 0x0B, 0x10, 0x08, 0x0A, 0x0B, 0x11, 0x03, 0x11, 
+  0x02, 0x14, 0x02, 0x17, 0x02, 0x18, 0x03, 0x19, 0x1C, 0x1E, 0x04, 0x19, 0x1B, 0x1E, 0x07, 0x1E, 
+  0x07, 0x1D, 0x08, 0x15, 0x16, 0x1D, 0x0E, 0x14, 0x18, 0x1C, 0x1A, 0x1B, 0x0D, 0x0E, 0x0D, 0x0E, 
+  0x0D, 0x0E, 0x0C, 0x0F, 0x1C, 0x1D, 0x0A, 0x0F, 0x1B, 0x1E, 0x09, 0x10, 0x13, 0x1E, 0x08, 0x1E, 
+  0x05, 0x1E, 0x04, 0x1A, 0x03, 0x16, 0x03, 0x15, 0x03, 0x14, 0x04, 0x16, 0x05, 0x06, 0x08, 0x18, 
+  0x08, 0x1A, 0x08, 0x1E, 0x09, 0x10, 0x12, 0x1E, 0x0A, 0x10, 0x17, 0x1E, 0x0C, 0x10, 0x1B, 0x1E, 
+  0x0D, 0x0F, 0x0D, 0x0E, 0x0C, 0x0F, 0x0C, 0x0F, 0x0D, 0x0E, 0x0A, 0x0F, 0x1B, 0x1E, 0x09, 0x0F, 
+  0x15, 0x1E, 0x08, 0x10, 0x12, 0x1E, 0x08, 0x1E, 0x05, 0x1A, 0x04, 0x19, 0x03, 0x16, 0x03, 0x14, 
+  0x03, 0x15, 0x04, 0x17, 0x05, 0x06, 0x08, 0x19, 0x08, 0x1A, 0x08, 0x1E, 0x09, 0x10, 0x13, 0x1E, 
+  0x0A, 0x10, 0x18, 0x1E, 0x0C, 0x10, 0x1C, 0x1D, 0x0D, 0x0F, 0x0A, 0x0C, 0x0A, 0x0C, 0x0B, 0x0D, 
+  0x0B, 0x0F, 0x0C, 0x0F, 0x0A, 0x0F, 0x09, 0x0F, 0x08, 0x15, 0x06, 0x1D, 0x05, 0x1D, 0x04, 0x1D, 
+  0x04, 0x1D, 0x05, 0x1E, 0x06, 0x1E, 0x07, 0x08, 0x09, 0x18, 0x1B, 0x1E, 0x09, 0x17, 0x09, 0x10, 
+  0x12, 0x14, 0x0A, 0x10, 0x08, 0x09, 0x08, 0x0A, 0x0B, 0x0C, 0x09, 0x0D, 0x08, 0x0E, 0x07, 0x0D, 
+  0x11, 0x12, 0x07, 0x19, 0x1C, 0x1E, 0x05, 0x1E, 0x04, 0x1E, 0x03, 0x1E, 0x02, 0x17, 0x03, 0x1C, 
+  0x03, 0x1D, 0x04, 0x1C, 0x07, 0x18, 0x07, 0x13, 0x14, 0x15, 0x08, 0x0F, 0x0A, 0x0E, 0x08, 0x0A, 
+  0x09, 0x0D, 0x08, 0x0E, 0x07, 0x0E, 0x10, 0x13, 0x07, 0x18, 0x04, 0x1E, 0x03, 0x1E, 0x02, 0x1E, 
+  0x02, 0x18, 0x03, 0x1D, 0x04, 0x1D, 0x05, 0x1D, 0x06, 0x19, 0x06, 0x13, 0x07, 0x11, 0x0A, 0x10, 
+  0x0C, 0x0D, 0x09, 0x0A, 0x09, 0x0B, 0x09, 0x0B, 0x0A, 0x0D, 0x08, 0x0E, 0x07, 0x0D, 0x11, 0x12, 
+  0x06, 0x17, 0x04, 0x1C, 0x03, 0x1D, 0x02, 0x1D, 0x02, 0x18, 0x1C, 0x1E, 0x02, 0x1E, 0x03, 0x1E, 
+  0x04, 0x1E, 0x06, 0x19, 0x07, 0x13, 0x07, 0x0F, 0x0A, 0x0E, 0x0A, 0x0B, 0x09, 0x16, 0x09, 0x1D, 
+  0x06, 0x07, 0x08, 0x1D, 0x05, 0x1D, 0x04, 0x1A, 0x1B, 0x1E, 0x04, 0x1E, 0x04, 0x1E, 0x05, 0x1E, 
+  0x06, 0x19, 0x1C, 0x1E, 0x08, 0x15, 0x17, 0x18, 0x1D, 0x1E, 0x09, 0x11, 0x0C, 0x10, 0x0E, 0x0F, 
+  0x0A, 0x16, 0x09, 0x1D, 0x06, 0x07, 0x08, 0x1D, 0x05, 0x1D, 0x04, 0x1E, 0x04, 0x1E, 0x04, 0x1E, 
+  0x05, 0x1E, 0x06, 0x19, 0x1C, 0x1E, 0x09, 0x15, 0x17, 0x18, 0x1D, 0x1E, 0x0A, 0x11, 0x0D, 0x10, 
+  
+};
+
+static const u16 g_player_span_index_mip2[451] = {
+  0x0000, 0x0000, 0x0000, 0x0001, 0x0002, 0x0003, 0x0004, 0x0005, 0x0006, 0x0007, 0x0008, 0x0009, 
+  0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x000A, 0x000B, 0x000D, 0x000E, 0x000F, 
+  0x0010, 0x0011, 0x0012, 0x0013, 0x0013, 0x0013, 0x0013, 0x0013, 0x0013, 0x0014, 0x0015, 0x0016, 
+  0x0017, 0x0018, 0x0019, 0x001B, 0x001C, 0x001D, 0x001D, 0x001D, 0x001D, 0x001D, 0x001D, 0x001D, 
+  0x001E, 0x001F, 0x0020, 0x0021, 0x0022, 0x0023, 0x0024, 0x0025, 0x0026, 0x0026, 0x0026, 0x0026, 
+  0x0026, 0x0026, 0x0026, 0x0026, 0x0026, 0x0027, 0x0028, 0x0029, 0x002A, 0x002B, 0x002C, 0x002C, 
+  0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002D, 0x002E, 0x002F, 0x0030, 
+  0x0031, 0x0032, 0x0032, 0x0032, 0x0032, 0x0032, 0x0032, 0x0032, 0x0032, 0x0032, 0x0033, 0x0034, 
+  0x0035, 0x0037, 0x0038, 0x0039, 0x003A, 0x003C, 0x003C, 0x003C, 0x003C, 0x003C, 0x003C, 0x003C, 
+  0x003C, 0x003D, 0x003E, 0x003F, 0x0040, 0x0041, 0x0042, 0x0043, 0x0044, 0x0044, 0x0044, 0x0044, 
+  0x0044, 0x0044, 0x0044, 0x0044, 0x0045, 0x0046, 0x0048, 0x0049, 0x004A, 0x004B, 0x004C, 0x004E, 
+  0x004F, 0x004F, 0x004F, 0x004F, 0x004F, 0x004F, 0x004F, 0x0050, 0x0051, 0x0052, 0x0053, 0x0054, 
+  0x0055, 0x0056, 0x0058, 0x0058, 0x0058, 0x0058, 0x0058, 0x0058, 0x0058, 0x0059, 0x005A, 0x005B, 
+  0x005C, 0x005D, 0x005F, 0x0061, 0x0062, 0x0063, 0x0065, 0x0065, 0x0065, 0x0065, 0x0065, 0x0065, 
+  0x0066, 0x0067, 0x0068, 0x0069, 0x006A, 0x006B, 0x006E, 0x006F, 0x0070, 0x0071, 0x0073, 0x0073, 
+  0x0073, 0x0073, 0x0073, 0x0074, 0x0076, 0x0078, 0x0079, 0x007B, 0x007C, 0x007D, 0x007E, 0x007F, 
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0081, 0x0082, 0x0084, 0x0086, 0x0088, 0x0089, 
+  0x008A, 0x008B, 0x008C, 0x008C, 0x008C, 0x008C, 0x008C, 0x008C, 0x008C, 0x008D, 0x008E, 0x0091, 
+  0x0093, 0x0094, 0x0095, 0x0096, 0x0098, 0x0099, 0x009A, 0x009A, 0x009A, 0x009A, 0x009A, 0x009A, 
+  0x009A, 0x009B, 0x009C, 0x009D, 0x009F, 0x00A1, 0x00A2, 0x00A4, 0x00A5, 0x00A5, 0x00A5, 0x00A5, 
+  0x00A5, 0x00A5, 0x00A6, 0x00A7, 0x00A8, 0x00A9, 0x00AB, 0x00AD, 0x00AF, 0x00B0, 0x00B1, 0x00B2, 
+  0x00B3, 0x00B4, 0x00B4, 0x00B4, 0x00B4, 0x00B5, 0x00B6, 0x00B7, 0x00B8, 0x00BA, 0x00BC, 0x00BE, 
+  0x00BF, 0x00C0, 0x00C1, 0x00C2, 0x00C4, 0x00C4, 0x00C4, 0x00C4, 0x00C4, 0x00C5, 0x00C6, 0x00C7, 
+  0x00CA, 0x00CB, 0x00CD, 0x00CE, 0x00CF, 0x00D0, 0x00D1, 0x00D2, 0x00D2, 0x00D2, 0x00D2, 0x00D2, 
+  0x00D2, 0x00D3, 0x00D4, 0x00D5, 0x00D7, 0x00D8, 0x00D9, 0x00DA, 0x00DB, 0x00DC, 0x00DC, 0x00DC, 
+  0x00DC, 0x00DC, 0x00DC, 0x00DD, 0x00DE, 0x00DF, 0x00E0, 0x00E1, 0x00E3, 0x00E4, 0x00E5, 0x00E7, 
+  0x00E8, 0x00E8, 0x00E8, 0x00E8, 0x00E8, 0x00E8, 0x00E9, 0x00EA, 0x00EB, 0x00EC, 0x00ED, 0x00EE, 
+  0x00EF, 0x00F0, 0x00F1, 0x00F2, 0x00F2, 0x00F2, 0x00F2, 0x00F2, 0x00F2, 0x00F2, 0x00F3, 0x00F5, 
+  0x00F6, 0x00F7, 0x00F8, 0x00F9, 0x00FA, 0x00FC, 0x00FD, 0x00FD, 0x00FD, 0x00FD, 0x00FD, 0x00FD, 
+  0x00FE, 0x00FF, 0x0101, 0x0102, 0x0103, 0x0104, 0x0105, 0x0106, 0x0108, 0x010A, 0x010A, 0x010A, 
+  0x010A, 0x010A, 0x010A, 0x010A, 0x010B, 0x010C, 0x010D, 0x010E, 0x010F, 0x0110, 0x0111, 0x0112, 
+  0x0112, 0x0112, 0x0112, 0x0112, 0x0112, 0x0112, 0x0112, 0x0113, 0x0114, 0x0116, 0x0117, 0x0118, 
+  0x0119, 0x011B, 0x011C, 0x011C, 0x011C, 0x011C, 0x011C, 0x011C, 0x011C, 0x011C, 0x011D, 0x011E, 
+  0x011F, 0x0120, 0x0121, 0x0122, 0x0123, 0x0124, 0x0124, 0x0124, 0x0124, 0x0124, 0x0124, 0x0124, 
+  0x0124, 0x0124, 0x0125, 0x0126, 0x0127, 0x0128, 0x0129, 0x012B, 0x012C, 0x012C, 0x012C, 0x012C, 
+  0x012C, 0x012C, 0x012C, 0x012C, 0x012C, 0x012D, 0x012E, 0x012F, 0x0130, 0x0132, 0x0133, 0x0133, 
+  0x0133, 0x0133, 0x0133, 0x0133, 0x0133, 0x0133, 0x0133, 0x0133, 0x0134, 0x0135, 0x0136, 0x0137, 
+  0x0139, 0x013A, 0x013A, 0x013A, 0x013A, 0x013A, 0x013A, 
+};
+static const u8 g_player_spans_mip2[628] = {
+  0x04, 0x07, 0x03, 0x09, 0x01, 0x0B, 0x01, 0x0E, 0x01, 0x0F, 0x03, 0x0F, 0x03, 0x06, 0x04, 0x06, 
+  0x04, 0x06, 0x04, 0x08, 0x03, 0x0B, 0x01, 0x0C, 0x0D, 0x0E, 0x01, 0x0E, 0x01, 0x0F, 0x03, 0x0F, 
+  0x04, 0x07, 0x04, 0x06, 0x03, 0x04, 0x05, 0x08, 0x03, 0x09, 0x03, 0x0D, 0x01, 0x0F, 0x01, 0x0E, 
+  0x01, 0x0E, 0x03, 0x07, 0x08, 0x09, 0x04, 0x07, 0x04, 0x05, 0x04, 0x08, 0x03, 0x0B, 0x02, 0x0F, 
+  0x01, 0x0E, 0x01, 0x0E, 0x02, 0x0C, 0x03, 0x07, 0x05, 0x07, 0x05, 0x06, 0x04, 0x08, 0x02, 0x0B, 
+  0x01, 0x0E, 0x01, 0x0E, 0x02, 0x0F, 0x03, 0x0F, 0x05, 0x08, 0x02, 0x0B, 0x01, 0x0E, 0x01, 0x0E, 
+  0x02, 0x0F, 0x03, 0x0F, 0x07, 0x08, 0x05, 0x08, 0x02, 0x09, 0x01, 0x0A, 0x0E, 0x0F, 0x01, 0x0F, 
+  0x02, 0x0F, 0x03, 0x0C, 0x04, 0x07, 0x0B, 0x0E, 0x07, 0x08, 0x06, 0x08, 0x04, 0x09, 0x01, 0x0A, 
+  0x01, 0x0C, 0x02, 0x0F, 0x03, 0x0F, 0x04, 0x07, 0x06, 0x08, 0x05, 0x09, 0x04, 0x08, 0x0E, 0x0F, 
+  0x01, 0x0F, 0x01, 0x0F, 0x02, 0x0B, 0x04, 0x0C, 0x04, 0x07, 0x0A, 0x0F, 0x0D, 0x0E, 0x07, 0x08, 
+  0x06, 0x08, 0x03, 0x09, 0x01, 0x0C, 0x01, 0x0F, 0x02, 0x0E, 0x03, 0x0E, 0x04, 0x07, 0x0C, 0x0E, 
+  0x06, 0x07, 0x06, 0x07, 0x06, 0x07, 0x06, 0x08, 0x06, 0x08, 0x06, 0x08, 0x0E, 0x0F, 0x02, 0x08, 
+  0x0D, 0x0F, 0x01, 0x0F, 0x01, 0x0F, 0x04, 0x0A, 0x0B, 0x0E, 0x06, 0x07, 0x06, 0x07, 0x06, 0x07, 
+  0x06, 0x07, 0x06, 0x08, 0x06, 0x08, 0x02, 0x04, 0x05, 0x08, 0x0E, 0x0F, 0x01, 0x0F, 0x01, 0x0F, 
+  0x04, 0x0E, 0x07, 0x09, 0x0D, 0x0E, 0x05, 0x09, 0x05, 0x09, 0x0E, 0x0F, 0x02, 0x08, 0x0E, 0x0F, 
+  0x01, 0x0F, 0x02, 0x0D, 0x0E, 0x0F, 0x04, 0x0B, 0x07, 0x0C, 0x0A, 0x0C, 0x0B, 0x0E, 0x0C, 0x0E, 
+  0x06, 0x07, 0x04, 0x08, 0x03, 0x04, 0x05, 0x08, 0x01, 0x08, 0x0E, 0x0F, 0x01, 0x0C, 0x0D, 0x0F, 
+  0x02, 0x0F, 0x04, 0x0C, 0x0B, 0x0E, 0x0C, 0x0E, 0x05, 0x08, 0x05, 0x09, 0x02, 0x04, 0x06, 0x08, 
+  0x0E, 0x0F, 0x01, 0x08, 0x09, 0x0F, 0x01, 0x0F, 0x03, 0x0C, 0x05, 0x0C, 0x0B, 0x0D, 0x0E, 0x0F, 
+  0x0C, 0x0F, 0x0D, 0x0E, 0x05, 0x08, 0x05, 0x09, 0x01, 0x08, 0x01, 0x08, 0x09, 0x0C, 0x02, 0x0D, 
+  0x0E, 0x0F, 0x04, 0x0F, 0x05, 0x09, 0x0B, 0x0F, 0x0C, 0x0E, 0x06, 0x07, 0x06, 0x07, 0x06, 0x08, 
+  0x06, 0x08, 0x06, 0x08, 0x0E, 0x0F, 0x06, 0x08, 0x0D, 0x0F, 0x03, 0x08, 0x09, 0x0F, 0x02, 0x0D, 
+  0x02, 0x0B, 0x02, 0x0C, 0x04, 0x0F, 0x0C, 0x0F, 0x06, 0x07, 0x06, 0x07, 0x06, 0x07, 0x06, 0x08, 
+  0x06, 0x08, 0x0E, 0x0F, 0x05, 0x09, 0x0D, 0x0F, 0x04, 0x08, 0x09, 0x0F, 0x02, 0x0D, 0x01, 0x0B, 
+  0x02, 0x0C, 0x04, 0x0F, 0x06, 0x07, 0x0C, 0x0F, 0x05, 0x07, 0x06, 0x07, 0x06, 0x09, 0x03, 0x09, 
+  0x0A, 0x0D, 0x0E, 0x0F, 0x02, 0x0F, 0x02, 0x0B, 0x0C, 0x0D, 0x04, 0x0B, 0x05, 0x0C, 0x0A, 0x0D, 
+  0x0C, 0x0F, 0x0D, 0x0E, 0x04, 0x06, 0x05, 0x07, 0x05, 0x08, 0x02, 0x0B, 0x0E, 0x0F, 0x01, 0x0F, 
+  0x01, 0x0F, 0x04, 0x0C, 0x07, 0x0F, 0x0C, 0x0E, 0x04, 0x05, 0x04, 0x06, 0x05, 0x06, 0x05, 0x08, 
+  0x02, 0x08, 0x01, 0x0A, 0x0D, 0x0E, 0x01, 0x0E, 0x03, 0x0E, 0x03, 0x0A, 0x0B, 0x0F, 0x0C, 0x0E, 
+  0x05, 0x06, 0x05, 0x06, 0x05, 0x07, 0x06, 0x08, 0x02, 0x08, 0x01, 0x0B, 0x01, 0x0C, 0x03, 0x0F, 
+  0x04, 0x0F, 0x0D, 0x0E, 0x06, 0x07, 0x05, 0x08, 0x0B, 0x0F, 0x03, 0x0F, 0x02, 0x0C, 0x02, 0x0A, 
+  0x02, 0x0B, 0x04, 0x0D, 0x05, 0x08, 0x0A, 0x0F, 0x06, 0x08, 0x06, 0x07, 0x06, 0x07, 0x05, 0x08, 
+  0x0C, 0x0F, 0x04, 0x0F, 0x02, 0x0D, 0x02, 0x0B, 0x02, 0x0B, 0x04, 0x0D, 0x04, 0x08, 0x09, 0x0F, 
+  0x06, 0x08, 0x0E, 0x0F, 0x05, 0x06, 0x06, 0x07, 0x05, 0x08, 0x04, 0x0D, 0x02, 0x0F, 0x02, 0x0F, 
+  0x03, 0x0F, 0x05, 0x0B, 0x04, 0x05, 0x04, 0x07, 0x03, 0x07, 0x08, 0x0A, 0x02, 0x0F, 0x01, 0x0C, 
+  0x01, 0x0E, 0x03, 0x0C, 0x0D, 0x0E, 0x04, 0x08, 0x04, 0x05, 0x04, 0x07, 0x03, 0x0D, 0x01, 0x0F, 
+  0x01, 0x0C, 0x02, 0x0E, 0x03, 0x0A, 0x04, 0x08, 0x05, 0x07, 0x03, 0x0A, 0x02, 0x0E, 0x01, 0x0F, 
+  0x01, 0x0F, 0x03, 0x0D, 0x0E, 0x0F, 0x03, 0x08, 0x04, 0x0D, 0x03, 0x0E, 0x02, 0x0F, 0x02, 0x0F, 
+  0x04, 0x0C, 0x0E, 0x0F, 0x05, 0x08, 0x05, 0x0D, 0x03, 0x0E, 0x02, 0x0F, 0x02, 0x0F, 0x04, 0x0C, 
+  0x0E, 0x0F, 0x06, 0x08, 
+};
+
+static const u16 g_player_span_index_mip3[241] = {
+  0x0000, 0x0000, 0x0001, 0x0002, 0x0003, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0005, 0x0006, 
+  0x0007, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0009, 0x000A, 0x000B, 0x000C, 0x000C, 0x000C, 
+  0x000C, 0x000C, 0x000D, 0x000E, 0x000F, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0011, 
+  0x0012, 0x0013, 0x0013, 0x0013, 0x0013, 0x0013, 0x0013, 0x0014, 0x0015, 0x0016, 0x0016, 0x0016, 
+  0x0016, 0x0016, 0x0016, 0x0017, 0x0018, 0x0019, 0x001B, 0x001B, 0x001B, 0x001B, 0x001B, 0x001C, 
+  0x001D, 0x001E, 0x001F, 0x001F, 0x001F, 0x001F, 0x0020, 0x0021, 0x0022, 0x0023, 0x0024, 0x0024, 
+  0x0024, 0x0024, 0x0024, 0x0025, 0x0026, 0x0027, 0x0029, 0x0029, 0x0029, 0x0029, 0x0029, 0x002A, 
+  0x002B, 0x002C, 0x002D, 0x002D, 0x002D, 0x002D, 0x002D, 0x002E, 0x002F, 0x0031, 0x0032, 0x0032, 
+  0x0032, 0x0032, 0x0033, 0x0035, 0x0036, 0x0037, 0x0038, 0x0038, 0x0038, 0x0038, 0x0039, 0x003A, 
+  0x003B, 0x003D, 0x003D, 0x003D, 0x003D, 0x003D, 0x003E, 0x0040, 0x0041, 0x0042, 0x0043, 0x0043, 
+  0x0043, 0x0043, 0x0044, 0x0046, 0x0047, 0x0048, 0x0048, 0x0048, 0x0048, 0x0048, 0x0048, 0x004A, 
+  0x004C, 0x004D, 0x004E, 0x004F, 0x004F, 0x004F, 0x004F, 0x0051, 0x0053, 0x0054, 0x0055, 0x0056, 
+  0x0056, 0x0056, 0x0056, 0x0058, 0x0059, 0x005A, 0x005B, 0x005B, 0x005B, 0x005B, 0x005C, 0x005D, 
+  0x005F, 0x0060, 0x0061, 0x0061, 0x0061, 0x0061, 0x0061, 0x0062, 0x0063, 0x0064, 0x0066, 0x0066, 
+  0x0066, 0x0066, 0x0066, 0x0067, 0x0068, 0x006A, 0x006C, 0x006C, 0x006C, 0x006C, 0x006C, 0x006D, 
+  0x006E, 0x006F, 0x0071, 0x0071, 0x0071, 0x0071, 0x0071, 0x0073, 0x0074, 0x0075, 0x0077, 0x0077, 
+  0x0077, 0x0077, 0x0077, 0x0078, 0x0079, 0x007A, 0x007B, 0x007B, 0x007B, 0x007B, 0x007B, 0x007C, 
+  0x007D, 0x007E, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x0080, 0x0081, 0x0082, 0x0083, 0x0083, 
+  0x0083, 0x0083, 0x0083, 0x0084, 0x0085, 0x0086, 0x0087, 0x0087, 0x0087, 0x0087, 0x0087, 0x0088, 
+  0x0089, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008B, 0x008C, 0x008D, 0x008D, 0x008D, 
+  0x008D, 
+};
+static const u8 g_player_spans_mip3[282] = {
+  0x02, 0x04, 0x01, 0x06, 0x01, 0x08, 0x02, 0x03, 0x02, 0x04, 0x01, 0x06, 0x01, 0x07, 0x02, 0x05, 
+  0x02, 0x04, 0x01, 0x08, 0x01, 0x07, 0x02, 0x03, 0x02, 0x04, 0x01, 0x08, 0x01, 0x07, 0x02, 0x03, 
+  0x02, 0x04, 0x00, 0x07, 0x02, 0x08, 0x02, 0x04, 0x00, 0x07, 0x02, 0x08, 0x02, 0x04, 0x01, 0x08, 
+  0x01, 0x07, 0x02, 0x03, 0x06, 0x07, 0x02, 0x04, 0x01, 0x06, 0x01, 0x08, 0x02, 0x03, 0x03, 0x04, 
+  0x02, 0x04, 0x01, 0x08, 0x01, 0x06, 0x06, 0x07, 0x02, 0x04, 0x01, 0x08, 0x01, 0x07, 0x02, 0x03, 
+  0x06, 0x07, 0x03, 0x04, 0x03, 0x04, 0x01, 0x08, 0x01, 0x08, 0x03, 0x04, 0x03, 0x04, 0x01, 0x05, 
+  0x06, 0x08, 0x01, 0x08, 0x03, 0x04, 0x01, 0x04, 0x05, 0x08, 0x01, 0x06, 0x04, 0x06, 0x06, 0x07, 
+  0x02, 0x04, 0x01, 0x04, 0x01, 0x08, 0x03, 0x04, 0x05, 0x07, 0x02, 0x04, 0x01, 0x04, 0x07, 0x08, 
+  0x01, 0x06, 0x05, 0x06, 0x06, 0x07, 0x03, 0x04, 0x01, 0x02, 0x03, 0x04, 0x01, 0x06, 0x02, 0x08, 
+  0x03, 0x04, 0x07, 0x08, 0x03, 0x04, 0x05, 0x08, 0x01, 0x06, 0x02, 0x06, 0x06, 0x07, 0x03, 0x04, 
+  0x07, 0x08, 0x02, 0x04, 0x05, 0x08, 0x01, 0x06, 0x02, 0x07, 0x06, 0x07, 0x03, 0x04, 0x07, 0x08, 
+  0x01, 0x08, 0x02, 0x06, 0x05, 0x08, 0x02, 0x03, 0x02, 0x04, 0x01, 0x06, 0x07, 0x08, 0x01, 0x06, 
+  0x05, 0x07, 0x02, 0x03, 0x01, 0x04, 0x01, 0x07, 0x02, 0x04, 0x06, 0x08, 0x03, 0x04, 0x01, 0x05, 
+  0x01, 0x06, 0x07, 0x08, 0x02, 0x05, 0x06, 0x07, 0x02, 0x08, 0x01, 0x05, 0x02, 0x06, 0x03, 0x04, 
+  0x06, 0x08, 0x02, 0x04, 0x05, 0x08, 0x01, 0x06, 0x01, 0x06, 0x02, 0x04, 0x06, 0x08, 0x03, 0x04, 
+  0x01, 0x07, 0x01, 0x08, 0x03, 0x04, 0x02, 0x03, 0x01, 0x08, 0x01, 0x07, 0x02, 0x03, 0x02, 0x05, 
+  0x01, 0x08, 0x01, 0x07, 0x03, 0x04, 0x02, 0x03, 0x01, 0x07, 0x01, 0x08, 0x02, 0x04, 0x02, 0x07, 
+  0x01, 0x08, 0x02, 0x05, 0x02, 0x07, 0x01, 0x08, 0x02, 0x05, 
+};
+static const u16* const g_player_span_index[MIP_LEVELS] = {
+  g_player_span_index_mip0,
+  g_player_span_index_mip1,
+  g_player_span_index_mip2,
+  g_player_span_index_mip3,
+};
+static const u8* const g_player_spans[MIP_LEVELS] = {
+  g_player_spans_mip0,
+  g_player_spans_mip1,
+  g_player_spans_mip2,
+  g_player_spans_mip3,
+};
+
 
 #define BULLET_TEXTURE_W 12
 #define BULLET_TEXTURE_H 12
@@ -1955,3 +4812,68 @@ static const u8 g_bullet_texture[BULLET_TEXTURE_W * BULLET_TEXTURE_H] = {
   0x00, 0x00, 0x0E, 0x09, 0x02, 0x02, 0x02, 0x02, 0x09, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x09, 0x02, 0x02, 0x02, 0x02, 0x09, 0x0E, 0x00, 0x00, 0x0E, 0x0E, 0x03, 0x03, 0x13, 0x04, 0x04, 0x04, 0x03, 0x03, 0x0E, 0x0E, 0x09, 0x09, 0x03, 0x03, 0x04, 0x04, 0x04, 0x04, 0x03, 0x03, 0x09, 0x09, 0x02, 0x02, 0x04, 0x04, 0x0C, 0x0C, 0x01, 0x01, 0x04, 0x04, 0x02, 0x02, 0x02, 0x02, 0x04, 0x04, 0x0C, 0x0C, 0x01, 0x01, 0x04, 0x04, 0x02, 0x02, 0x02, 0x02, 0x04, 0x04, 0x01, 0x01, 0x01, 0x01, 0x04, 0x04, 0x02, 0x02, 0x02, 0x02, 0x04, 0x04, 0x01, 0x01, 0x01, 0x01, 0x04, 0x04, 0x02, 0x02, 0x09, 0x09, 0x03, 0x03, 0x0A, 0x07, 0x0D, 0x14, 0x03, 0x03, 0x09, 0x09, 0x0E, 0x0E, 0x03, 0x03, 0x10, 0x0F, 0x12, 0x11, 0x03, 0x03, 0x0E, 0x0E, 0x00, 0x00, 0x0E, 0x08, 0x02, 0x02, 0x02, 0x02, 0x0B, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x06, 0x02, 0x02, 0x02, 0x02, 0x05, 0x0E, 0x00, 0x00, 
 };
 
+static const u8 g_bullet_texture_mip1[6 * 6] = {
+  0x00, 0x09, 0x02, 0x02, 0x09, 0x00, 0x09, 0x03, 0x04, 0x04, 0x03, 0x09, 0x02, 0x04, 0x0C, 0x01, 
+  0x04, 0x02, 0x02, 0x04, 0x01, 0x01, 0x04, 0x02, 0x09, 0x03, 0x12, 0x12, 0x03, 0x09, 0x00, 0x09, 
+  0x02, 0x02, 0x09, 0x00, 
+};
+
+static const u8 g_bullet_texture_mip2[3 * 3] = {
+  0x02, 0x04, 0x02, 0x02, 0x01, 0x02, 0x02, 0x04, 0x02, 
+};
+
+static const u8 g_bullet_texture_mip3[2 * 2] = {
+  0x11, 0x02, 0x02, 0x02, 
+};
+
+static const u32 g_bullet_mip_w[MIP_LEVELS] = { 12, 6, 3, 2 };
+static const u32 g_bullet_mip_h[MIP_LEVELS] = { 12, 6, 3, 2 };
+static const u8* const g_bullet_mips[MIP_LEVELS] = {
+  g_bullet_texture,
+  g_bullet_texture_mip1,
+  g_bullet_texture_mip2,
+  g_bullet_texture_mip3,
+};
+
+static const u16 g_bullet_span_index_mip0[13] = {
+  0x0000, 0x0001, 0x0002, 0x0003, 0x0004, 0x0005, 0x0006, 0x0007, 0x0008, 0x0009, 0x000A, 0x000B, 
+  0x000C, 
+};
+static const u8 g_bullet_spans_mip0[24] = {
+  0x02, 0x0A, 0x02, 0x0A, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x0C, 
+  0x00, 0x0C, 0x00, 0x0C, 0x02, 0x0A, 0x02, 0x0A, 
+};
+
+static const u16 g_bullet_span_index_mip1[7] = {
+  0x0000, 0x0001, 0x0002, 0x0003, 0x0004, 0x0005, 0x0006, 
+};
+static const u8 g_bullet_spans_mip1[12] = {
+  0x01, 0x05, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x01, 0x05, 
+};
+
+static const u16 g_bullet_span_index_mip2[4] = {
+  0x0000, 0x0001, 0x0002, 0x0003, 
+};
+static const u8 g_bullet_spans_mip2[6] = {
+  0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 
+};
+
+static const u16 g_bullet_span_index_mip3[3] = {
+  0x0000, 0x0001, 0x0002, 
+};
+static const u8 g_bullet_spans_mip3[4] = {
+  0x00, 0x02, 0x00, 0x02, 
+};
+static const u16* const g_bullet_span_index[MIP_LEVELS] = {
+  g_bullet_span_index_mip0,
+  g_bullet_span_index_mip1,
+  g_bullet_span_index_mip2,
+  g_bullet_span_index_mip3,
+};
+static const u8* const g_bullet_spans[MIP_LEVELS] = {
+  g_bullet_spans_mip0,
+  g_bullet_spans_mip1,
+  g_bullet_spans_mip2,
+  g_bullet_spans_mip3,
+};
+
@@ -12,8 +12,36 @@ struct fb {
   u32 stride;
 };
 
+/* Internal resolution of the 3D view, it can be lower than the resolution of
+ * the host framebuffer, in which case it is upscaled by cb_present(..).
+ */
+struct cb {
+  u32 w, h;
+};
+
+#define CB_MIN_WIDTH  (FB_WIDTH >> 2)
+#define CB_MIN_HEIGHT (FB_HEIGHT >> 2)
+
+/* Columns of the z-buffer summarized by each depth tile */
+#define ZB_TILE  8
+#define ZB_TILES (FB_WIDTH / ZB_TILE)
+
+/* Nearest and farthest depth of the columns in a tile */
+struct zb_tile {
+  f32 min, max;
+};
+
 extern struct fb _g_fb;
+extern struct cb _g_cb;
 extern f32 _g_zbuf[FB_WIDTH];
+extern struct zb_tile _g_zbuf_tiles[ZB_TILES];
+/* Column-major render target for the 3D view: every screen column is stored
+ * contiguously, so that drawing down a column touches consecutive addresses.
+ * It is copied to the host framebuffer with cb_present(..).
+ * NOTE: Columns are always FB_HEIGHT pixels apart, even when the internal
+ *       resolution is lower.
+ */
+extern u32 _g_cbuf[FB_WIDTH * FB_HEIGHT];
 
 static inline
 u32 _fb_offset(u32 x, u32 y) {
@@ -30,6 +58,25 @@ u32 fb_get_pixel(u32 x, u32 y) {
   return _g_fb.pxls[_fb_offset(x, y)];
 }
 
+static inline
+u32* cb_get_column(u32 x) {
+  return &_g_cbuf[x * FB_HEIGHT];
+}
+
+static inline
+u32 cb_width(void) {
+  return _g_cb.w;
+}
+
+static inline
+u32 cb_height(void) {
+  return _g_cb.h;
+}
+
+void cb_set_resolution(u32 w, u32 h);
+void cb_present(u32 x_start, u32 x_end);
+void zb_build_tiles(u32 x_start, u32 x_end, u32 step);
+
 static inline
 void zb_set_depth(u32 x, f32 depth) {
   _g_zbuf[x] = depth;
@@ -40,4 +87,10 @@ f32 zb_get_depth(u32 x) {
   return _g_zbuf[x];
 }
 
+/* Depth tile that holds column @x */
+static inline
+const struct zb_tile* zb_get_tile(u32 x) {
+  return &_g_zbuf_tiles[x / ZB_TILE];
+}
+
 #endif
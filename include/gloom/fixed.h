@@ -0,0 +1,74 @@
+#ifndef FIXED_H_
+#define FIXED_H_
+
+#include <gloom/types.h>
+
+/* 16.16 fixed point numbers, used by the simulation when it is built with
+ * USE_FIXED_POINT_SIM (see game_move_and_collide).
+ *
+ * NOTE: Map coordinates need at most 6 integer bits, so every fixed point
+ *       position fits the 24 bits of precision of a f32 and converting it
+ *       back and forth is lossless.
+ */
+typedef i32 fixed;
+
+#define FIX_SHIFT 16
+#define FIX_ONE   (1 << FIX_SHIFT)
+#define FIX_FRAC  (FIX_ONE - 1)
+
+/* Round @x to the closest fixed point number */
+static inline
+fixed fix_from_f32(f32 x) {
+  x *= (f32)FIX_ONE;
+  return (fixed)(x < 0.0f ? x - 0.5f : x + 0.5f);
+}
+
+static inline
+f32 fix_to_f32(fixed x) {
+  return (f32)x * (1.0f / (f32)FIX_ONE);
+}
+
+static inline
+fixed fix_from_int(i32 x) {
+  return x << FIX_SHIFT;
+}
+
+/* Integer part of @x, rounded towards negative infinity */
+static inline
+i32 fix_to_int(fixed x) {
+  return x >> FIX_SHIFT;
+}
+
+static inline
+fixed fix_mul(fixed a, fixed b) {
+  return (fixed)(((i64)a * b) >> FIX_SHIFT);
+}
+
+static inline
+fixed fix_div(fixed a, fixed b) {
+  return (fixed)(((i64)a << FIX_SHIFT) / b);
+}
+
+/* Square root of @v, rounded down. Digit by digit, one bit at a time. */
+static inline
+u32 fix_isqrt(u64 v) {
+  u64 bit = 1ULL << 62, r = 0;
+  for (; bit > v; bit >>= 2)
+    ;
+  for (; bit != 0; bit >>= 2) {
+    if (v >= r + bit) {
+      v -= r + bit;
+      r = (r >> 1) + bit;
+    } else
+      r >>= 1;
+  }
+  return (u32)r;
+}
+
+/* Length of the vector (@x, @y), rounded down */
+static inline
+fixed fix_length(fixed x, fixed y) {
+  return (fixed)fix_isqrt((u64)((i64)x * x + (i64)y * y));
+}
+
+#endif
@@ -6,6 +6,10 @@
 #define PLAYER_RUN_SPEED    3.5f
 #define PLAYER_ROT_SPEED    0.01f
 
+/* Fixed simulation steps per second, and their length (see game_tick) */
+#define SIM_RATE 60
+#define SIM_STEP (1.0f / SIM_RATE)
+
 #define MAX_CAMERA_FOV 120.0f
 #define MIN_CAMERA_FOV 30.0f
 
@@ -18,7 +22,8 @@
 #define MAX_MAP_HEIGHT 64
 #define MAX_MAP_WIDTH  64
 
-#define MAX_SPRITES   255
+#define MAX_SPRITES     255
+#define MAX_PROJECTILES 255
 
 struct camera {
   u32 dof;
@@ -56,32 +61,90 @@ struct sprite_desc {
 struct sprite {
   struct sprite_desc desc;
   f32 rot;
-  vec2f pos;
-  vec2f vel;
   struct {
     b8 disabled;
-    i32 screen_x;
-    i32 screen_halfw;
-    f32 inv_depth;
-    f32 depth2;
     f32 anim_frame;
-    f32 rel_rot;
   };
 };
 
+/* Sprite ids are 8 bits wide */
+#define MAX_SPRITE_IDS 256
+
+/* Positions and velocities are kept apart from struct sprite, one array per
+ * field indexed by slot, as the simulation and the projection go through
+ * all of them every step and frame.
+ */
 struct sprites {
   u32 n;
   struct sprite s[MAX_SPRITES];
+  f32 x[MAX_SPRITES];
+  f32 y[MAX_SPRITES];
+  f32 vel_x[MAX_SPRITES];
+  f32 vel_y[MAX_SPRITES];
+  /* Slot + 1 of the sprite with each id, 0 if there is none */
+  u8 slots[MAX_SPRITE_IDS];
+  /* Bumped whenever the sprite with each id is created or destroyed, so it
+   * is odd exactly while the sprite exists.
+   */
+  u16 gens[MAX_SPRITE_IDS];
+};
+
+/* Reference to a sprite that stays valid while the sprite moves around
+ * g_sprites, and goes stale once it is destroyed, even if the server
+ * reuses its id (see game_get_sprite). A zeroed handle is never valid.
+ */
+struct sprite_handle {
+  u16 gen;
+  u8 id;
+};
+
+/* Bullets are kept apart from the other sprites, as they only ever move in
+ * a straight line and are never animated: every field is its own array, so
+ * that they can be moved and projected in batches.
+ */
+struct projectiles {
+  u32 n;
+  f32 x[MAX_PROJECTILES];
+  f32 y[MAX_PROJECTILES];
+  f32 vel_x[MAX_PROJECTILES];
+  f32 vel_y[MAX_PROJECTILES];
+  u8 id[MAX_PROJECTILES];
+  u8 owner[MAX_PROJECTILES];
+  b8 disabled[MAX_PROJECTILES];
+  /* Index + 1 of the projectile with each id, 0 if there is none */
+  u8 slots[MAX_SPRITE_IDS];
 };
 
+enum axis_dir {
+  AXIS_POS_X,
+  AXIS_NEG_X,
+  AXIS_POS_Y,
+  AXIS_NEG_Y,
+  AXIS_MAX
+};
+
+/* There is no wall between the cell and the edge of the map */
+#define MAP_NO_WALL 0xFF
+
 struct map {
   u32 w, h;
   u8 tiles[MAX_MAP_WIDTH * MAX_MAP_HEIGHT];
+  /* Chebyshev distance from each cell to the closest wall, cells outside of
+   * the map count as walls (see game_build_map_distances).
+   */
+  u8 dist[MAX_MAP_WIDTH * MAX_MAP_HEIGHT];
+  /* Number of cells from each cell to the closest wall straight along each
+   * axis direction, 0 if the cell is a wall itself or MAP_NO_WALL if there
+   * is none (see game_build_map_distances).
+   */
+  u8 axis_dist[AXIS_MAX][MAX_MAP_WIDTH * MAX_MAP_HEIGHT];
 };
 
 struct hit {
   f32 dist;
   b8 vertical;
+  /* Cell the ray stopped in */
+  vec2u cell;
 };
 
 extern const f32 g_sprite_radius[SPRITE_MAX];
@@ -98,9 +161,26 @@ void game_player_set_rot(f32 new_rot);
 void game_player_add_rot(f32 delta);
 
 vec2f game_get_player_velocity(void);
+vec2f game_get_move_diff(const vec2f* vel, f32 delta);
 b8    game_move_and_collide(vec2f* pos, vec2f* diff, f32 radius);
 
+void game_build_map_distances(void);
+
+struct sprite*       game_get_sprite(struct sprite_handle handle);
+struct sprite_handle game_get_sprite_handle(const struct sprite* s);
+
+void game_grid_update(u32 slot);
+void game_grid_remove(u8 id);
+void game_grid_rebuild(void);
+
 void game_init_player(vec2f pos, f32 rot);
+f32  game_get_sim_lag(void);
+
+u32  game_get_step(void);
+b8   game_rollback(u32 step);
+void game_resimulate(u32 step);
+void game_clear_snapshots(void);
+
 void game_tick(f32 delta);
 void game_update(f32 delta);
 void game_render(void);
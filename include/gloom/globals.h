@@ -9,7 +9,7 @@
  *       globally to make the code compile.
  */
 
-struct sprite;
+struct sprite_handle;
 
 extern const struct state_handlers
   g_error_state,
@@ -23,10 +23,11 @@ extern const struct state_handlers
 extern struct player g_player;
 extern struct camera g_camera;
 extern struct sprites g_sprites;
+extern struct projectiles g_projectiles;
 extern struct map g_map;
 extern union keys g_keys;
 
-extern struct sprite* g_tracked_sprite;
+extern struct sprite_handle g_tracked_sprite;
 extern f32 g_mouse_sensitivity;
 
 void g_settings_apply(void);
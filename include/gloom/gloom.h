@@ -23,4 +23,14 @@ void gloom_framebuffer_set(void* fb, u32 stride);
 u32  gloom_framebuffer_width(void);
 u32  gloom_framebuffer_height(void);
 
+void gloom_set_interlacing(b8 enabled);
+
+#ifdef USE_PLATFORM_CLOCK
+void gloom_set_frame_budget(f32 budget_ms);
+#endif
+
+#ifdef USE_PLATFORM_THREADS
+void gloom_render_strip(u32 strip, u32 n_strips);
+#endif
+
 #endif
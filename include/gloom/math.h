@@ -46,6 +46,12 @@ u32 abs(i32 v) {
   return (v > 0) ? v : -v;
 }
 
+/* Index of the lowest set bit of @v, which must not be zero */
+static inline
+u32 ctz(u32 v) {
+  return __builtin_ctz(v);
+}
+
 #define VEC2ADD(v, w)     \
   ((typeof(*(v))) {       \
     .x = (v)->x + (w)->x, \
@@ -9,9 +9,21 @@ extern void platform_pointer_release(void);
 extern i32  platform_send_packet(void* pkt, u32 len);
 extern void platform_settings_store(f32 drawdist, f32 fov, f32 mousesens, b8 camsmooth);
 extern f32  platform_get_time(void);
+#ifdef USE_PLATFORM_CLOCK
+/* Monotonic wall clock in microseconds, only meaningful as the difference of
+ * two readings. Unlike platform_get_time() it is not driven by the game.
+ */
+extern u32  platform_clock_us(void);
+#endif
 #ifdef USE_PLATFORM_COS
 extern f32  platform_cos(f32 angle);
 #endif
 extern f32  platform_acos(f32 value);
+#ifdef USE_PLATFORM_THREADS
+/* Call gloom_render_strip(i, n) for every i in [0, n) and return once all the
+ * calls have completed. The host picks n (usually its number of workers).
+ */
+extern void platform_render_strips(void);
+#endif
 
 #endif
@@ -2,6 +2,7 @@
 #define TYPES_H_
 
 #define PACKED __attribute__((packed))
+#define ALWAYS_INLINE inline __attribute__((always_inline))
 
 #define _STATIC_ASSERT(x) _Static_assert(x, #x)
 
@@ -10,6 +11,11 @@ _STATIC_ASSERT(sizeof(u32) == 4);
 typedef /******/ int i32;
 _STATIC_ASSERT(sizeof(i32) == 4);
 
+typedef unsigned long long u64;
+_STATIC_ASSERT(sizeof(u64) == 8);
+typedef /******/ long long i64;
+_STATIC_ASSERT(sizeof(i64) == 8);
+
 typedef unsigned short u16;
 _STATIC_ASSERT(sizeof(u16) == 2);
 typedef /******/ short i16;
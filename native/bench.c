@@ -0,0 +1,319 @@
+#include <gloom/gloom.h>
+#include <gloom/game.h>
+#include <gloom/globals.h>
+#include <gloom/color.h>
+#include <gloom/libc.h>
+
+#include "native.h"
+
+/* End-to-end frame benchmark.
+ *
+ * Builds worst-case scenes (a full 64x64 map, MAX_SPRITES sprites and the
+ * maximum draw distance) and reports per-frame time percentiles of
+ * game_tick(..), along with its update and render halves timed on their own
+ * (game_tick(..) also steps the fixed rate simulation, saves snapshots and
+ * runs the resolution controller).
+ *
+ * Before that, it checks that rolling the player back by a few simulation
+ * steps and replaying them (see game_rollback) puts it back where it was.
+ *
+ * USAGE: gloom-bench [FRAMES]
+ */
+
+#define DEFAULT_FRAMES 600
+#define MAX_FRAMES     8192
+#define WARMUP_FRAMES  30
+
+#define BENCH_DELTA (1.0f / 60.0f)
+
+/* Half-amplitude of the camera sweep, in radians */
+#define BENCH_SWEEP 0.3f
+
+/* Steps the player walks for before the rollback check, and how many of
+ * them are replayed.
+ */
+#define ROLLBACK_WALK_STEPS 24
+#define ROLLBACK_STEPS      12
+
+enum bench_stage {
+  STAGE_UPDATE,
+  STAGE_RENDER,
+  STAGE_TICK,
+  STAGE_MAX
+};
+
+static const char* const g_stage_names[STAGE_MAX] = {
+  [STAGE_UPDATE] = "update",
+  [STAGE_RENDER] = "render",
+  [STAGE_TICK]   = "tick  "
+};
+
+/* Sprites are placed at most NEAR_SPRITES_DIST away from the camera in the
+ * "near" scene, where they cover most of the screen.
+ */
+#define NEAR_SPRITES_DIST 3.0f
+
+struct scene {
+  const char* name;
+  b8 pillars;
+  u32 n_sprites;
+  f32 max_dist;
+};
+
+static const struct scene g_scenes[] = {
+  { .name = "open         ", .pillars = false, .n_sprites = 0,
+    .max_dist = MAX_CAMERA_DOF },
+  { .name = "pillars      ", .pillars = true,  .n_sprites = 0,
+    .max_dist = MAX_CAMERA_DOF },
+  { .name = "crowd        ", .pillars = false, .n_sprites = MAX_SPRITES,
+    .max_dist = MAX_CAMERA_DOF },
+  { .name = "pillars+crowd", .pillars = true,  .n_sprites = MAX_SPRITES,
+    .max_dist = MAX_CAMERA_DOF },
+  { .name = "near         ", .pillars = false, .n_sprites = 32,
+    .max_dist = NEAR_SPRITES_DIST },
+};
+
+static u32 g_samples[STAGE_MAX][MAX_FRAMES];
+static struct sprites g_sprites_template;
+static struct projectiles g_projectiles_template;
+static u32 g_seed;
+
+static inline
+u32 rand_u32(void) {
+  /* Numerical Recipes LCG, good enough to scatter sprites around */
+  g_seed = g_seed * 1664525U + 1013904223U;
+  return g_seed >> 8;
+}
+
+static inline
+f32 rand_f32(f32 min, f32 max) {
+  return min + (max - min) * (f32)(rand_u32() & 0xFFFF) / (f32)0xFFFF;
+}
+
+static
+void build_map(b8 pillars) {
+  u32 x, y;
+  b8 wall;
+
+  g_map.w = MAX_MAP_WIDTH;
+  g_map.h = MAX_MAP_HEIGHT;
+  for (y = 0; y < g_map.h; ++y) {
+    for (x = 0; x < g_map.w; ++x) {
+      wall = x == 0 || y == 0 || x == g_map.w - 1 || y == g_map.h - 1;
+      /* Scatter single cell pillars to break the view into many faces */
+      if (pillars)
+        wall |= (x % 6) == 3 && (y % 6) == 3;
+      g_map.tiles[x + y * g_map.w] = wall;
+    }
+  }
+  game_build_map_distances();
+}
+
+static
+void build_sprites(u32 n, f32 max_dist) {
+  u32 i, j;
+  f32 dist, angle, rot;
+  vec2f pos;
+  struct sprite* s;
+
+  memset(&g_sprites_template, 0, sizeof(g_sprites_template));
+  memset(&g_projectiles_template, 0, sizeof(g_projectiles_template));
+
+  for (i = 0; i < n; ++i) {
+    /* Place the sprite inside the view cone of the camera, so that every
+     * sprite gets projected and drawn.
+     */
+    dist = rand_f32(1.0f, max_dist);
+    angle = QUARTER_PI + rand_f32(-BENCH_SWEEP, +BENCH_SWEEP);
+    pos.x = 2.5f + cos(angle) * dist;
+    pos.y = 2.5f + sin(angle) * dist;
+    pos.x = MIN(pos.x, (f32)MAX_MAP_WIDTH - 1.5f);
+    pos.y = MIN(pos.y, (f32)MAX_MAP_HEIGHT - 1.5f);
+    rot = rand_f32(0.0f, TWO_PI);
+
+    /* One sprite in five is a bullet */
+    if ((i % 5) == 4) {
+      j = g_projectiles_template.n++;
+      g_projectiles_template.id[j] = i + 1;
+      g_projectiles_template.owner[j] = i;
+      g_projectiles_template.x[j] = pos.x;
+      g_projectiles_template.y[j] = pos.y;
+      g_projectiles_template.vel_x[j] = cos(rot) * PLAYER_RUN_SPEED;
+      g_projectiles_template.vel_y[j] = sin(rot) * PLAYER_RUN_SPEED;
+      g_projectiles_template.slots[i + 1] = j + 1;
+      continue;
+    }
+
+    j = g_sprites_template.n++;
+    s = &g_sprites_template.s[j];
+    s->desc.type = SPRITE_PLAYER;
+    s->desc.id = i + 1;
+    s->rot = rot;
+    g_sprites_template.x[j] = pos.x;
+    g_sprites_template.y[j] = pos.y;
+    g_sprites_template.vel_x[j] = cos(rot) * PLAYER_RUN_SPEED;
+    g_sprites_template.vel_y[j] = sin(rot) * PLAYER_RUN_SPEED;
+    g_sprites_template.slots[i + 1] = j + 1;
+    g_sprites_template.gens[i + 1] = 1;
+  }
+}
+
+/* Restore the scene to its initial state, so that every frame renders
+ * (roughly) the same amount of stuff.
+ */
+static inline
+void reset_scene(u32 frame, u32 frames) {
+  f32 phase;
+
+  g_sprites = g_sprites_template;
+  g_projectiles = g_projectiles_template;
+  game_grid_rebuild();
+  g_tracked_sprite = (struct sprite_handle) {0};
+
+  /* Sweep the camera back and forth across the scene */
+  phase = TWO_PI * (f32)frame / (f32)frames;
+  g_player.pos = (vec2f) { 2.5f, 2.5f };
+  game_player_set_rot(QUARTER_PI + BENCH_SWEEP * sin(phase));
+}
+
+static
+void sort_samples(u32* v, u32 n) {
+  u32 i, j, gap, x;
+  /* Shell sort with Ciura's gap sequence */
+  static const u32 gaps[] = { 701, 301, 132, 57, 23, 10, 4, 1 };
+
+  for (gap = 0; gap < ARRLEN(gaps); ++gap) {
+    for (i = gaps[gap]; i < n; ++i) {
+      x = v[i];
+      for (j = i; j >= gaps[gap] && v[j - gaps[gap]] > x; j -= gaps[gap])
+        v[j] = v[j - gaps[gap]];
+      v[j] = x;
+    }
+  }
+}
+
+static inline
+u32 percentile(const u32* sorted, u32 n, u32 p) {
+  return sorted[(n - 1) * p / 100];
+}
+
+static
+void report(const struct scene* scene, u32 frames) {
+  u32 i, stage;
+  u32 sum, *v;
+
+  for (stage = 0; stage < STAGE_MAX; ++stage) {
+    v = g_samples[stage];
+    sort_samples(v, frames);
+
+    sum = 0;
+    for (i = 0; i < frames; ++i)
+      sum += v[i] / 1000;
+
+    printf("%s  %s  mean %u  p50 %u  p90 %u  p99 %u  max %u\n",
+           scene->name, g_stage_names[stage], sum / frames,
+           percentile(v, frames, 50) / 1000,
+           percentile(v, frames, 90) / 1000,
+           percentile(v, frames, 99) / 1000,
+           v[frames - 1] / 1000);
+  }
+}
+
+static
+void run_scene(const struct scene* scene, u32 frames) {
+  u32 i, t0, t1, t2, t3;
+
+  g_seed = 0x600D;
+  build_map(scene->pillars);
+  build_sprites(scene->n_sprites, scene->max_dist);
+
+  for (i = 0; i < WARMUP_FRAMES; ++i) {
+    reset_scene(i, frames);
+    game_tick(BENCH_DELTA);
+  }
+
+  for (i = 0; i < frames; ++i) {
+    reset_scene(i, frames);
+    native_advance_time(BENCH_DELTA);
+
+    t0 = native_clock_ns();
+    game_update(BENCH_DELTA);
+    t1 = native_clock_ns();
+    game_render();
+    t2 = native_clock_ns();
+
+    /* Then the whole frame, from the same starting point */
+    reset_scene(i, frames);
+    game_tick(BENCH_DELTA);
+    t3 = native_clock_ns();
+
+    g_samples[STAGE_UPDATE][i] = t1 - t0;
+    g_samples[STAGE_RENDER][i] = t2 - t1;
+    g_samples[STAGE_TICK][i] = t3 - t2;
+  }
+
+  report(scene, frames);
+}
+
+/* Walk the player through the pillars, turning a little every step, then
+ * roll it back and replay the last steps. Returns true if the replay ends
+ * exactly where the steps did.
+ */
+static
+b8 check_rollback(void) {
+  u32 i, step;
+  vec2f pos;
+
+  build_map(true);
+  game_init_player((vec2f) { 2.5f, 2.5f }, QUARTER_PI);
+  game_analog_set(0.0f, 1.0f);
+  for (i = 0; i < ROLLBACK_WALK_STEPS; ++i) {
+    game_player_add_rot(0.05f);
+    game_tick(SIM_STEP);
+  }
+  game_analog_set(0.0f, 0.0f);
+
+  step = game_get_step();
+  pos = g_player.pos;
+  if (!game_rollback(step - ROLLBACK_STEPS))
+    return false;
+  game_resimulate(step);
+  return game_get_step() == step &&
+         g_player.pos.x == pos.x && g_player.pos.y == pos.y;
+}
+
+static
+u32 parse_u32(const char* s) {
+  u32 v = 0;
+  for (; *s >= '0' && *s <= '9'; ++s)
+    v = v * 10 + (*s - '0');
+  return v;
+}
+
+int main(int argc, char** argv) {
+  u32 i, frames;
+
+  frames = argc > 1 ? parse_u32(argv[1]) : DEFAULT_FRAMES;
+  if (frames == 0 || frames > MAX_FRAMES) {
+    eprintf("number of frames must be between 1 and %u\n", MAX_FRAMES);
+    return 1;
+  }
+
+  native_init();
+  color_set_alpha(0xFF);
+  /* Maximum draw distance, widest field of view, no camera smoothing */
+  gloom_settings_load(1.0f, 0.0f, 0.5f, false);
+
+  if (!check_rollback()) {
+    eprintf("replaying %u steps after a rollback diverged\n", ROLLBACK_STEPS);
+    return 1;
+  }
+  game_init_player((vec2f) { 2.5f, 2.5f }, QUARTER_PI);
+
+  printf("%u frames per scene, %u sprites max, draw distance %u (times in us)\n",
+         frames, MAX_SPRITES, g_camera.dof);
+  for (i = 0; i < ARRLEN(g_scenes); ++i)
+    run_scene(&g_scenes[i], frames);
+
+  return 0;
+}
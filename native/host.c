@@ -0,0 +1,174 @@
+#include <gloom/gloom.h>
+
+#include "native.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* Headless host that replays a script through the gloom_on_* entry points.
+ *
+ * The script is a text file with one command per line, empty lines and
+ * lines starting with '#' are ignored:
+ *
+ *   init <ws_connected> <game_id> <player_token>
+ *   settings <drawdist> <fov> <mousesens> <camsmooth>
+ *   budget <ms>                   frame budget for dynamic resolution
+ *                                 (needs USE_PLATFORM_CLOCK)
+ *   interlace <0|1>               interlaced rendering of the 3D view
+ *   lock <0|1>                    pointer lock state change
+ *   analog <x> <y>
+ *   move <x> <y> <dx> <dy>        mouse moved
+ *   down <x> <y> <button>         mouse button pressed
+ *   up <x> <y> <button>           mouse button released
+ *   packet <hex bytes>            packet received from the server
+ *   close                         websocket closed
+ *   tick <delta> [count]          run @count frames (default 1)
+ *   dump <path>                   write the framebuffer to a PPM file
+ *
+ * USAGE: gloom-host SCRIPT
+ */
+
+#define MAX_LINE   4096
+#define MAX_PACKET 2048
+
+struct host_stats {
+  u32 frames;
+  u32 line;
+  f32 tick_ms;
+};
+
+static
+i32 parse_hex_packet(const char* s, u8* buf, u32 size) {
+  u32 len = 0;
+  i32 hi = -1, v;
+
+  for (; *s; ++s) {
+    if (*s >= '0' && *s <= '9')
+      v = *s - '0';
+    else if (*s >= 'a' && *s <= 'f')
+      v = *s - 'a' + 0xA;
+    else if (*s >= 'A' && *s <= 'F')
+      v = *s - 'A' + 0xA;
+    else if (*s == ' ' || *s == '\t' || *s == '\n')
+      continue;
+    else
+      return -1;
+
+    if (hi < 0)
+      hi = v;
+    else {
+      if (len >= size)
+        return -1;
+      buf[len++] = (u8)((hi << 4) | v);
+      hi = -1;
+    }
+  }
+
+  /* Odd number of digits */
+  return hi < 0 ? (i32)len : -1;
+}
+
+/* Run @count frames. Returns false once the core asks to stop ticking */
+static
+b8 run_frames(struct host_stats* stats, f32 delta, u32 count) {
+  u32 start;
+  b8 should_tick = true;
+
+  for (; count > 0 && should_tick; --count) {
+    native_advance_time(delta);
+    start = native_clock_ns();
+    should_tick = gloom_tick(delta);
+    stats->tick_ms += (f32)(native_clock_ns() - start) * 1e-6f;
+    ++stats->frames;
+  }
+
+  return should_tick;
+}
+
+/* Execute a single script command. Returns false to stop the replay */
+static
+b8 run_command(struct host_stats* stats, char* line) {
+  u8 pkt[MAX_PACKET];
+  char cmd[16], arg[MAX_LINE];
+  f32 fx, fy, fz;
+  u32 ux, uy, uz, uw;
+  i32 ix, iy, n;
+
+  if (sscanf(line, "%15s%n", cmd, &n) != 1 || cmd[0] == '#')
+    return true;
+  line += n;
+
+  if (!strcmp(cmd, "init") && sscanf(line, "%u %u %u", &ux, &uy, &uz) == 3)
+    gloom_init(ux != 0, uy, uz);
+  else if (!strcmp(cmd, "settings") &&
+           sscanf(line, "%f %f %f %u", &fx, &fy, &fz, &uw) == 4)
+    gloom_settings_load(fx, fy, fz, uw != 0);
+#ifdef USE_PLATFORM_CLOCK
+  else if (!strcmp(cmd, "budget") && sscanf(line, "%f", &fx) == 1)
+    gloom_set_frame_budget(fx);
+#endif
+  else if (!strcmp(cmd, "interlace") && sscanf(line, "%u", &ux) == 1)
+    gloom_set_interlacing(ux != 0);
+  else if (!strcmp(cmd, "lock") && sscanf(line, "%u", &ux) == 1)
+    gloom_set_pointer_locked(ux != 0);
+  else if (!strcmp(cmd, "analog") && sscanf(line, "%f %f", &fx, &fy) == 2)
+    gloom_on_analog_change(fx, fy);
+  else if (!strcmp(cmd, "move") &&
+           sscanf(line, "%u %u %d %d", &ux, &uy, &ix, &iy) == 4)
+    gloom_on_mouse_moved(ux, uy, ix, iy);
+  else if (!strcmp(cmd, "down") && sscanf(line, "%u %u %u", &ux, &uy, &uz) == 3)
+    gloom_on_mouse_down(ux, uy, uz);
+  else if (!strcmp(cmd, "up") && sscanf(line, "%u %u %u", &ux, &uy, &uz) == 3)
+    gloom_on_mouse_up(ux, uy, uz);
+  else if (!strcmp(cmd, "packet")) {
+    if ((n = parse_hex_packet(line, pkt, sizeof(pkt))) < 0) {
+      fprintf(stderr, "line %u: malformed packet\n", stats->line);
+      return false;
+    }
+    gloom_on_recv_packet(pkt, n);
+  } else if (!strcmp(cmd, "close"))
+    gloom_on_ws_close();
+  else if (!strcmp(cmd, "tick") && (n = sscanf(line, "%f %u", &fx, &ux)) >= 1)
+    return run_frames(stats, fx, n == 2 ? ux : 1);
+  else if (!strcmp(cmd, "dump") && sscanf(line, "%s", arg) == 1) {
+    if (!native_dump_framebuffer(arg))
+      fprintf(stderr, "line %u: could not write %s\n", stats->line, arg);
+  } else {
+    fprintf(stderr, "line %u: invalid command '%s'\n", stats->line, cmd);
+    return false;
+  }
+
+  return true;
+}
+
+int main(int argc, char** argv) {
+  FILE* script;
+  char line[MAX_LINE];
+  struct host_stats stats = {0};
+
+  if (argc != 2) {
+    fprintf(stderr, "USAGE: %s SCRIPT\n", argv[0]);
+    return 1;
+  }
+
+  if ((script = fopen(argv[1], "r")) == NULL) {
+    perror(argv[1]);
+    return 1;
+  }
+
+  native_init();
+  while (fgets(line, sizeof(line), script) != NULL) {
+    ++stats.line;
+    if (!run_command(&stats, line))
+      break;
+  }
+  fclose(script);
+
+  fprintf(stderr, "%u frames in %.3f ms (%.3f ms/frame), %u packets sent\n",
+          stats.frames, stats.tick_ms,
+          stats.frames > 0 ? stats.tick_ms / stats.frames : 0.0f,
+          native_sent_packets());
+
+  return 0;
+}
@@ -0,0 +1,56 @@
+#ifndef NATIVE_H_
+#define NATIVE_H_
+
+/* Native (Linux) host for the gloom core.
+ *
+ * The browser normally provides the platform_* imports declared in
+ * gloom/platform.h, this directory provides them on a regular Linux box
+ * instead, so that the core can be driven headlessly and benchmarked.
+ *
+ * Build from the repository root with:
+ *
+ *   CFLAGS="-O2 -ffreestanding -fno-strict-aliasing -Iinclude -Igen"
+ *   CORE="$(find src -name '*.c')"
+ *   cc $CFLAGS $CORE native/platform.c native/host.c -lm -o gloom-host
+ *   cc $CFLAGS $CORE native/platform.c native/bench.c -lm -o gloom-bench
+ *
+ * Add -DUSE_PLATFORM_THREADS -pthread to CFLAGS to render the 3D view on
+ * multiple threads, GLOOM_RENDER_THREADS sets the number of render workers
+ * (defaults to the number of online CPUs).
+ *
+ * Add -DUSE_PLATFORM_CLOCK to let the core time its own frames and scale
+ * the resolution of the 3D view to stay within the budget set with
+ * gloom_set_frame_budget(..) (the "budget" script command).
+ *
+ * Add -DUSE_FRONT_TO_BACK_SPRITES to draw sprites nearest first, writing
+ * every pixel at most once. It pays off when many sprites overlap.
+ *
+ * Add -DUSE_FIXED_POINT_SIM to run movement and collisions in 16.16 fixed
+ * point, with results that are the same on every platform.
+ *
+ * NOTE: The core and the files in this directory that include system headers
+ *       must never include each other's headers, as the core libc.h and
+ *       math.h clash with the system ones.
+ */
+
+#include <gloom/types.h>
+
+/* Initialize the host: allocate the framebuffer and hand it to the core */
+void native_init(void);
+
+/* Advance the virtual clock driving platform_get_time() */
+void native_advance_time(f32 delta);
+
+/* Monotonic wall clock in nanoseconds. It wraps around every ~4 seconds,
+ * so it must only be used to measure short intervals (e.g. a single frame)
+ * by subtracting two readings.
+ */
+u32 native_clock_ns(void);
+
+/* Number of packets the core has sent since native_init() */
+u32 native_sent_packets(void);
+
+/* Write the current framebuffer contents to @path as a binary PPM */
+b8 native_dump_framebuffer(const char* path);
+
+#endif
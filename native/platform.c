@@ -0,0 +1,189 @@
+#include <gloom/gloom.h>
+#include <gloom/platform.h>
+#include <gloom/fb.h>
+
+#include "native.h"
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include <unistd.h>
+#ifdef USE_PLATFORM_THREADS
+#include <pthread.h>
+#endif
+
+static u32 g_native_fb[FB_WIDTH * FB_HEIGHT];
+static f32 g_native_time;
+static u32 g_sent_packets;
+
+void native_init(void) {
+  g_native_time = 0.0f;
+  g_sent_packets = 0;
+  gloom_framebuffer_set(g_native_fb, FB_WIDTH);
+}
+
+void native_advance_time(f32 delta) {
+  g_native_time += delta;
+}
+
+u32 native_clock_ns(void) {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (u32)ts.tv_sec * 1000000000U + (u32)ts.tv_nsec;
+}
+
+u32 native_sent_packets(void) {
+  return g_sent_packets;
+}
+
+b8 native_dump_framebuffer(const char* path) {
+  FILE* f;
+  u32 i, px;
+  u8 rgb[3];
+
+  if ((f = fopen(path, "wb")) == NULL)
+    return false;
+
+  fprintf(f, "P6\n%u %u\n255\n", FB_WIDTH, FB_HEIGHT);
+  for (i = 0; i < FB_WIDTH * FB_HEIGHT; ++i) {
+    /* Pixels are stored as 0xAABBGGRR (see color.c) */
+    px = g_native_fb[i];
+    rgb[0] = px & 0xFF;
+    rgb[1] = (px >> 8) & 0xFF;
+    rgb[2] = (px >> 16) & 0xFF;
+    fwrite(rgb, sizeof(rgb), 1, f);
+  }
+
+  fclose(f);
+  return true;
+}
+
+/* Platform imports */
+
+void platform_write(int fd, const char* s, u32 l) {
+  while (l > 0) {
+    ssize_t n = write(fd, s, l);
+    if (n <= 0)
+      return;
+    s += n;
+    l -= n;
+  }
+}
+
+/* There is no pointer to lock: the host script decides when the pointer is
+ * locked by calling gloom_set_pointer_locked(..) explicitly.
+ */
+void platform_pointer_lock(void) {}
+void platform_pointer_release(void) {}
+
+i32 platform_send_packet(void* pkt, u32 len) {
+  /* There is no server, pretend the packet was sent */
+  (void)pkt;
+  ++g_sent_packets;
+  return len;
+}
+
+void platform_settings_store(f32 drawdist, f32 fov, f32 mousesens,
+                             b8 camsmooth) {
+  /* Settings are not persisted on the native host */
+  (void)drawdist;
+  (void)fov;
+  (void)mousesens;
+  (void)camsmooth;
+}
+
+f32 platform_get_time(void) {
+  return g_native_time;
+}
+
+#ifdef USE_PLATFORM_CLOCK
+u32 platform_clock_us(void) {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (u32)ts.tv_sec * 1000000U + (u32)ts.tv_nsec / 1000U;
+}
+#endif
+
+#ifdef USE_PLATFORM_COS
+f32 platform_cos(f32 angle) {
+  return cosf(angle);
+}
+#endif
+
+f32 platform_acos(f32 value) {
+  return acosf(value);
+}
+
+#ifdef USE_PLATFORM_THREADS
+
+#define MAX_RENDER_WORKERS 64
+
+/* Render workers are created on the first frame and then kept parked on
+ * g_strips_start. The calling thread renders strip 0 itself.
+ */
+static u32 g_n_strips;
+static pthread_barrier_t g_strips_start, g_strips_done;
+
+static
+void* render_worker(void* arg) {
+  u32 strip = (u32)(size_t)arg;
+  for (;;) {
+    pthread_barrier_wait(&g_strips_start);
+    gloom_render_strip(strip, g_n_strips);
+    pthread_barrier_wait(&g_strips_done);
+  }
+  return NULL;
+}
+
+static
+u32 get_render_workers(void) {
+  const char* env;
+  long n;
+
+  /* GLOOM_RENDER_THREADS overrides the number of online CPUs */
+  if ((env = getenv("GLOOM_RENDER_THREADS")) != NULL)
+    n = atol(env);
+  else
+    n = sysconf(_SC_NPROCESSORS_ONLN);
+
+  if (n < 1)
+    return 1;
+  return n > MAX_RENDER_WORKERS ? MAX_RENDER_WORKERS : (u32)n;
+}
+
+static
+void start_render_workers(void) {
+  u32 i;
+  pthread_t thread;
+
+  g_n_strips = get_render_workers();
+  if (g_n_strips == 1)
+    return;
+
+  pthread_barrier_init(&g_strips_start, NULL, g_n_strips);
+  pthread_barrier_init(&g_strips_done, NULL, g_n_strips);
+  for (i = 1; i < g_n_strips; ++i) {
+    if (pthread_create(&thread, NULL, render_worker, (void*)(size_t)i)) {
+      perror("pthread_create");
+      exit(1);
+    }
+    pthread_detach(thread);
+  }
+}
+
+void platform_render_strips(void) {
+  if (g_n_strips == 0)
+    start_render_workers();
+
+  if (g_n_strips == 1) {
+    gloom_render_strip(0, 1);
+    return;
+  }
+
+  pthread_barrier_wait(&g_strips_start);
+  gloom_render_strip(0, g_n_strips);
+  pthread_barrier_wait(&g_strips_done);
+}
+
+#endif
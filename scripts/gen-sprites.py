@@ -6,6 +6,10 @@ PLAYER_SPRITE_H = 59
 BULLET_SPRITE_W = 12
 BULLET_SPRITE_H = 12
 
+# number of mip levels, including the full size one (each level is half the
+# size of the previous one)
+MIP_LEVELS = 4
+
 try:
     import imageio.v3 as iio
     import numpy as np
@@ -40,6 +44,106 @@ def load_image(image_name, transparency_color=None):
     return width, height, image_indexed, color_table
 
 
+def mip_size(size, level):
+    # round up, so that every texel of the full size texture is covered
+    return -(-size // (1 << level))
+
+
+def gen_mip(texture, width, height, color_table, level):
+    """
+    Downscale an indexed texture by 2^level. Each texel of the result covers
+    a block of texels of the full size texture: it is transparent if most of
+    the block is, otherwise its color is the average of the opaque texels in
+    the block, snapped to the closest color in the color table.
+    """
+    scale = 1 << level
+    mip_w, mip_h = mip_size(width, level), mip_size(height, level)
+    texture = np.array(texture).reshape(height, width)
+    # split colors in channels (index 0 is always the transparency color)
+    colors = np.array(
+        [[(c >> s) & 0xFF for s in (0, 8, 16)] for c in color_table], np.float64
+    )
+    mip = []
+    for y in range(mip_h):
+        for x in range(mip_w):
+            block = texture[y * scale : (y + 1) * scale, x * scale : (x + 1) * scale]
+            opaque = block[block != 0]
+            if len(opaque) * 2 < block.size:
+                mip.append(0)
+                continue
+            average = colors[opaque].mean(axis=0)
+            distances = ((colors[1:] - average) ** 2).sum(axis=1)
+            mip.append(1 + int(distances.argmin()))
+    return mip_w, mip_h, mip
+
+
+def gen_texture_array(name, size, data):
+    csrc = f"static const u8 {name}[{size}] = {{\n  "
+    for i, x in enumerate(data):
+        csrc += f"0x{x:02X}, "
+        if i % 16 == 15:
+            csrc += "\n  "
+    csrc += "\n};\n"
+    return csrc
+
+
+def gen_span_tables(array_prefix, levels, n_textures):
+    """
+    Generate the opaque runs of every column of every texture, at every mip
+    level. For each level, {array_prefix}_span_index_mip{level} holds the
+    index of the first run of each column (with the columns of all textures
+    one after the other, plus one past the last), and
+    {array_prefix}_spans_mip{level} holds the runs as [start, end) rows.
+    """
+    csrc = ""
+    for level, (width, height, data) in enumerate(levels):
+        textures = np.array(data).reshape(n_textures, height, width)
+        index, spans = [], []
+        for texture in textures:
+            for x in range(width):
+                index.append(len(spans) // 2)
+                column = list(texture[:, x] != 0) + [False]
+                y = 0
+                while y < height:
+                    if not column[y]:
+                        y += 1
+                        continue
+                    start = y
+                    while column[y]:
+                        y += 1
+                    spans += [start, y]
+        index.append(len(spans) // 2)
+        # ensure the indices fit in a u16
+        assert index[-1] < 0x10000
+
+        csrc += f"\nstatic const u16 {array_prefix}_span_index_mip{level}"
+        csrc += f"[{len(index)}] = {{\n  "
+        for i, x in enumerate(index):
+            csrc += f"0x{x:04X}, "
+            if i % 12 == 11:
+                csrc += "\n  "
+        csrc += "\n};\n"
+        csrc += gen_texture_array(
+            f"{array_prefix}_spans_mip{level}", len(spans), spans
+        )
+
+    for name, ctype in (("span_index", "u16"), ("spans", "u8")):
+        csrc += f"static const {ctype}* const {array_prefix}_{name}[MIP_LEVELS] = {{\n"
+        csrc += "".join(
+            f"  {array_prefix}_{name}_mip{level},\n" for level in range(MIP_LEVELS)
+        )
+        csrc += "};\n"
+    return csrc
+
+
+def gen_mip_tables(array_prefix, sizes):
+    csrc = f"static const u32 {array_prefix}_mip_w[MIP_LEVELS] = {{ "
+    csrc += ", ".join(str(w) for w, _ in sizes) + " };\n"
+    csrc += f"static const u32 {array_prefix}_mip_h[MIP_LEVELS] = {{ "
+    csrc += ", ".join(str(h) for _, h in sizes) + " };\n"
+    return csrc
+
+
 def gen_player_spritesheet():
     width, height, image_indexed, color_table = load_image(
         "player-sheet", transparency_color=0xFFFFFF00
@@ -56,6 +160,8 @@ def gen_player_spritesheet():
 
     # generate defines
     csrc = f"""/* This file is automatically generated by {path.basename(sys.argv[0])} */
+#define MIP_LEVELS {MIP_LEVELS}
+
 #define PLAYER_TILE_W {PLAYER_SPRITE_W}
 #define PLAYER_TILE_H {PLAYER_SPRITE_H}
 
@@ -94,6 +200,48 @@ static const u8 g_player_spritesheet[PLAYER_NTILES * PLAYER_TILE_W * PLAYER_TILE
                 csrc += "\n  "
     csrc += "};\n"
 
+    # generate the mip chain of every tile
+    sheet = np.array(image_indexed).reshape(height, width)
+    sizes = [(PLAYER_SPRITE_W, PLAYER_SPRITE_H)]
+    names = ["g_player_spritesheet"]
+    levels = [
+        (
+            PLAYER_SPRITE_W,
+            PLAYER_SPRITE_H,
+            sheet.reshape(n_sprites_h, PLAYER_SPRITE_H, n_sprites_w, PLAYER_SPRITE_W)
+            .transpose(0, 2, 1, 3)
+            .flatten(),
+        )
+    ]
+    for level in range(1, MIP_LEVELS):
+        mip_data = []
+        for y in range(n_sprites_h):
+            for x in range(n_sprites_w):
+                tile = sheet[
+                    y * PLAYER_SPRITE_H : (y + 1) * PLAYER_SPRITE_H,
+                    x * PLAYER_SPRITE_W : (x + 1) * PLAYER_SPRITE_W,
+                ]
+                mip_w, mip_h, mip = gen_mip(
+                    tile.flatten(),
+                    PLAYER_SPRITE_W,
+                    PLAYER_SPRITE_H,
+                    color_table,
+                    level,
+                )
+                mip_data += mip
+        sizes.append((mip_w, mip_h))
+        levels.append((mip_w, mip_h, mip_data))
+        names.append(f"g_player_spritesheet_mip{level}")
+        csrc += "\n" + gen_texture_array(
+            names[-1], f"PLAYER_NTILES * {mip_w} * {mip_h}", mip_data
+        )
+
+    csrc += "\n" + gen_mip_tables("g_player", sizes)
+    csrc += "static const u8* const g_player_mips[MIP_LEVELS] = {\n"
+    csrc += "".join(f"  {name},\n" for name in names)
+    csrc += "};\n"
+    csrc += gen_span_tables("g_player", levels, n_sprites)
+
     return csrc
 
 
@@ -132,6 +280,25 @@ static const u8 g_bullet_texture[BULLET_TEXTURE_W * BULLET_TEXTURE_H] = {
         csrc += f"0x{i:02X}, "
     csrc += "\n};\n"
 
+    # generate the mip chain of the texture
+    sizes = [(BULLET_SPRITE_W, BULLET_SPRITE_H)]
+    names = ["g_bullet_texture"]
+    levels = [(BULLET_SPRITE_W, BULLET_SPRITE_H, image_indexed)]
+    for level in range(1, MIP_LEVELS):
+        mip_w, mip_h, mip = gen_mip(
+            image_indexed, BULLET_SPRITE_W, BULLET_SPRITE_H, color_table, level
+        )
+        sizes.append((mip_w, mip_h))
+        levels.append((mip_w, mip_h, mip))
+        names.append(f"g_bullet_texture_mip{level}")
+        csrc += "\n" + gen_texture_array(names[-1], f"{mip_w} * {mip_h}", mip)
+
+    csrc += "\n" + gen_mip_tables("g_bullet", sizes)
+    csrc += "static const u8* const g_bullet_mips[MIP_LEVELS] = {\n"
+    csrc += "".join(f"  {name},\n" for name in names)
+    csrc += "};\n"
+    csrc += gen_span_tables("g_bullet", levels, 1)
+
     return csrc
 
 
@@ -41,7 +41,6 @@ void gloom_set_pointer_locked(b8 locked) {
      */
     if (client_get_state() == CLIENT_GAME) {
       /* Notify the server the player has stopped */
-      multiplayer_queue_input();
       multiplayer_send_update();
       /* Switch to pause menu */
       client_switch_state(CLIENT_PAUSE);
@@ -84,7 +83,7 @@ b8 gloom_tick(f32 delta) {
 void gloom_init(b8 ws_connected, u32 game_id, u32 player_token) {
   _g_pointer_locked = false;
   g_should_tick = true;
-  g_tracked_sprite = NULL;
+  g_tracked_sprite = (struct sprite_handle) {0};
   g_settings_apply();
   multiplayer_init(game_id, player_token);
   client_switch_state(ws_connected ? CLIENT_LOADING : CLIENT_ERROR);
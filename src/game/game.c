@@ -1,8 +1,10 @@
 #include <gloom/game.h>
+#include <gloom/gloom.h>
 #include <gloom/ui.h>
 #include <gloom/libc.h>
 #include <gloom/color.h>
 #include <gloom/globals.h>
+#include <gloom/fixed.h>
 
 #include "sprites.c"
 
@@ -29,9 +31,146 @@
 
 #define CAMERA_POS_INTERP 0.66f
 
+/* The simulation advances in fixed steps of SIM_STEP seconds, whatever the
+ * frame rate is. After a long frame at most MAX_SIM_STEPS steps are run, the
+ * rest of the time is dropped.
+ */
+#define MAX_SIM_STEPS 8
+
+/* Number of steps the simulation can be rolled back by (see game_rollback) */
+#define MAX_SNAPSHOTS 16
+
+#ifdef USE_PLATFORM_CLOCK
+/* Dynamic resolution controller settings */
+#define FRAME_TIME_SMOOTHING 0.9f
+#define VIEW_SCALE_STEP      0.05f
+#define VIEW_SCALE_COOLDOWN  15
+#define VIEW_SCALE_HEADROOM  0.75f
+#endif
+
+/* Interlaced rendering falls back to rendering every column when the camera
+ * turns by more than INTERLACE_MAX_SHIFT columns in a single frame, or when
+ * moving may have shifted walls on screen by more than INTERLACE_MAX_ERROR
+ * pixels. Turns are made up for by reprojecting the columns that are not
+ * rendered (see reproject_columns), moves are not.
+ */
+#define INTERLACE_MAX_SHIFT 16
+#define INTERLACE_MAX_ERROR 1.0f
+
 static i32 g_display_health;
 static vec2f g_joystick;
 
+/* Resolution of the 3D view for the current frame, and its ratio to the
+ * framebuffer resolution (used to scale sprites).
+ */
+static struct {
+  u32 w, h;
+  f32 scale_x, scale_y;
+} g_view;
+
+#ifdef USE_PLATFORM_CLOCK
+static struct {
+  f32 budget;     /* Target game_tick(..) time in seconds, 0 if disabled */
+  f32 frame_time; /* Smoothed game_tick(..) time in seconds */
+  f32 scale;      /* Current scale of the 3D view on both axes */
+  u32 cooldown;   /* Frames to wait before changing scale again */
+} g_resolution = { .scale = 1.0f };
+#endif
+
+/* Interlaced rendering (see gloom_set_interlacing) only renders the columns
+ * x for which (x % step) == parity, the other columns show what was drawn on
+ * the last frame, moved to where the camera turning puts it.
+ */
+static struct {
+  b8 enabled;
+  u32 step, parity;
+  f32 rot;              /* Camera rotation on the last frame */
+  vec2f pos, dir;       /* Camera position and direction on the last frame */
+  vec2f plane;          /* Camera plane on the last frame */
+  f32 plane_halfw;      /* Camera plane half width on the last frame */
+  i32 stale_start;      /* Columns [stale_start, stale_end) turned into view */
+  i32 stale_end;        /* this frame, see fill_stale_columns */
+} g_interlace = { .step = 1 };
+
+/* Fixed timestep simulation state (see game_tick). The positions are the ones
+ * from before the last step, frames are drawn interpolating between them and
+ * the current ones.
+ */
+static struct {
+  f32 lag;   /* Frame time the simulation has not caught up with yet */
+  f32 alpha; /* Interpolation weight of the current positions */
+  u32 step;  /* Number of steps taken so far */
+  vec2f player_pos;
+  /* Positions of the sprites, by id, and their generation at the time */
+  vec2f sprite_pos[MAX_SPRITE_IDS];
+  u16 sprite_gen[MAX_SPRITE_IDS];
+  /* Positions of the projectiles, by id, and the step they were saved on */
+  vec2f projectile_pos[MAX_SPRITE_IDS];
+  u32 projectile_step[MAX_SPRITE_IDS];
+} g_sim = { .alpha = 1.0f };
+
+static inline
+vec2f interpolate_pos(vec2f prev, vec2f pos) {
+  return (vec2f) {
+    lerp(g_sim.alpha, prev.x, pos.x),
+    lerp(g_sim.alpha, prev.y, pos.y)
+  };
+}
+
+/* Position to draw the player at this frame */
+static inline
+vec2f get_player_draw_pos(void) {
+  return interpolate_pos(g_sim.player_pos, g_player.pos);
+}
+
+/* Position to draw the sprite in @slot at this frame. Sprites created after
+ * the last step have no previous position, and are drawn where they are.
+ */
+static inline
+vec2f get_sprite_draw_pos(u32 slot) {
+  const u8 id = g_sprites.s[slot].desc.id;
+  const vec2f pos = { g_sprites.x[slot], g_sprites.y[slot] };
+  if (g_sim.sprite_gen[id] != g_sprites.gens[id])
+    return pos;
+  return interpolate_pos(g_sim.sprite_pos[id], pos);
+}
+
+/* Position to draw the projectile at index @i at this frame */
+static inline
+vec2f get_projectile_draw_pos(u32 i) {
+  const u8 id = g_projectiles.id[i];
+  const vec2f pos = { g_projectiles.x[i], g_projectiles.y[i] };
+  if (g_sim.projectile_step[id] != g_sim.step)
+    return pos;
+  return interpolate_pos(g_sim.projectile_pos[id], pos);
+}
+
+/* First column rendered this frame at or after @x */
+static inline
+i32 first_column(i32 x) {
+  return x + ((x ^ g_interlace.parity) & (g_interlace.step - 1));
+}
+
+/* Last column rendered this frame at or before @x */
+static inline
+i32 last_column(i32 x) {
+  return x - ((x ^ g_interlace.parity) & (g_interlace.step - 1));
+}
+
+/* Rows [top, bottom) of a column that do not hold the background */
+struct span {
+  i16 top, bottom;
+};
+
+/* Background colors the column buffer was last filled with, and the rows of
+ * each column that have been drawn over since.
+ */
+static struct {
+  u32 sky, floor;
+  u32 w, h;
+} g_background;
+static struct span g_dirty_spans[FB_WIDTH];
+
 const vec2i g_sprite_dims[] = {
   [SPRITE_PLAYER] = { .x = PLAYER_SPRITE_W, .y = PLAYER_SPRITE_H },
   [SPRITE_BULLET] = { .x = BULLET_SPRITE_W, .y = BULLET_SPRITE_H }
@@ -104,14 +243,21 @@ void game_player_add_rot(f32 delta) {
   game_player_set_rot(new_rot);
 }
 
+/* Shortest jump trace_ray(..) takes across empty space, shorter jumps cost
+ * more than the steps they save.
+ */
+#define MIN_SAFE_JUMP 4
+
 /* Use the DDA algorithm to trace a ray */
 static
 u8 trace_ray(const vec2f* pos, const vec2f* ray_dir, u32 dof, struct hit* hit) {
   vec2f delta_dist, dist, intersec_dist;
-  vec2f dpos;
+  vec2f dpos, abs_dir;
   vec2i step_dir;
   vec2u map_coords;
-  u32 d;
+  u32 d, index, n_x, n_y;
+  i32 safe;
+  f32 last_x, last_y;
   b8 vertical, cell_id;
 
   dpos.x = pos->x - (i32)pos->x;
@@ -120,6 +266,9 @@ u8 trace_ray(const vec2f* pos, const vec2f* ray_dir, u32 dof, struct hit* hit) {
   delta_dist.y = absf(1.0f / ray_dir->x);
   delta_dist.x = absf(1.0f / ray_dir->y);
 
+  abs_dir.x = absf(ray_dir->x);
+  abs_dir.y = absf(ray_dir->y);
+
   dist.x = isposf(ray_dir->x) ? (1.0f - dpos.x) : dpos.x;
   dist.y = isposf(ray_dir->y) ? (1.0f - dpos.y) : dpos.y;
 
@@ -138,9 +287,46 @@ u8 trace_ray(const vec2f* pos, const vec2f* ray_dir, u32 dof, struct hit* hit) {
     if (map_coords.x >= g_map.w || map_coords.y >= g_map.h)
       break;
 
-    if ((cell_id = g_map.tiles[map_coords.x + map_coords.y * g_map.w]))
+    index = map_coords.x + map_coords.y * g_map.w;
+    if ((cell_id = g_map.tiles[index]))
       break;
 
+    /* Every cell less than g_map.dist[index] cells away (along both axes)
+     * is empty: jump to the last one the ray crosses, taking all the steps
+     * to get there at once.
+     */
+    safe = (i32)g_map.dist[index] - 1;
+    if (safe >= MIN_SAFE_JUMP) {
+      last_x = intersec_dist.y + (f32)(safe - 1) * delta_dist.y;
+      last_y = intersec_dist.x + (f32)(safe - 1) * delta_dist.x;
+      if (last_x < last_y) {
+        /* The ray crosses @safe columns first */
+        n_x = safe;
+        n_y = last_x < intersec_dist.x ?
+              0 : (u32)((last_x - intersec_dist.x) * abs_dir.y) + 1;
+        vertical = true;
+      } else {
+        n_y = safe;
+        n_x = last_y <= intersec_dist.y ?
+              0 : (u32)((last_y - intersec_dist.y) * abs_dir.x) + 1;
+        vertical = false;
+      }
+
+      if (d + n_x + n_y <= dof) {
+        /* NOTE: the delta along an axis the ray never crosses is infinite */
+        if (n_x > 0) {
+          intersec_dist.y += (f32)n_x * delta_dist.y;
+          map_coords.x += (i32)n_x * step_dir.x;
+        }
+        if (n_y > 0) {
+          intersec_dist.x += (f32)n_y * delta_dist.x;
+          map_coords.y += (i32)n_y * step_dir.y;
+        }
+        d += n_x + n_y - 1;
+        continue;
+      }
+    }
+
     if (intersec_dist.y < intersec_dist.x) {
       intersec_dist.y += delta_dist.y;
       map_coords.x += step_dir.x;
@@ -155,42 +341,228 @@ u8 trace_ray(const vec2f* pos, const vec2f* ray_dir, u32 dof, struct hit* hit) {
   hit->dist = vertical ?
               intersec_dist.y - delta_dist.y : intersec_dist.x - delta_dist.x;
   hit->vertical = vertical;
+  hit->cell = map_coords;
 
   return cell_id;
 }
 
+#ifdef USE_FIXED_POINT_SIM
+
+/* The simulation runs in fixed point, so that it gives the same results
+ * on every platform, bit for bit (see gloom/fixed.h). Positions and
+ * velocities are still stored as f32, but they only ever hold values that
+ * come out of the fixed point code.
+ */
+
+/* Same as the f32 version below, but the position is (@x, @y) */
+static inline
+b8 get_axis_wall_dist(fixed x, fixed y, enum axis_dir dir, fixed* dist) {
+  const u32 cell_x = fix_to_int(x), cell_y = fix_to_int(y);
+  fixed frac, edge;
+  u8 steps;
+
+  /* There is nothing to collide with outside of the map */
+  if (cell_x >= g_map.w || cell_y >= g_map.h)
+    return false;
+
+  steps = g_map.axis_dist[dir][cell_x + cell_y * g_map.w];
+  if (steps >= COLL_DOF)
+    return false;
+
+  /* Distance to the side of the cell facing @dir */
+  frac = (dir < AXIS_POS_Y ? x : y) & FIX_FRAC;
+  edge = dir == AXIS_POS_X || dir == AXIS_POS_Y ? FIX_ONE - frac : frac;
+
+  *dist = edge + fix_from_int((i32)steps - 1);
+  return true;
+}
+
 b8 game_move_and_collide(vec2f* pos, vec2f* diff, f32 radius) {
-  struct hit hit;
-  f32 v_dist, h_dist;
-  vec2f v_dir, h_dir;
+  const fixed x = fix_from_f32(pos->x), y = fix_from_f32(pos->y);
+  const fixed r = fix_from_f32(radius);
+  fixed dx = fix_from_f32(diff->x), dy = fix_from_f32(diff->y), wall_dist;
   b8 collided = false;
 
   /* Check for collisions on the y-axis */
-  v_dir.x = 0.0f;
-  v_dir.y = signf(diff->y);
+  if (get_axis_wall_dist(x, y, dy >= 0 ? AXIS_POS_Y : AXIS_NEG_Y,
+                         &wall_dist) &&
+      wall_dist < MAX(dy, -dy) + r) {
+    dy = dy >= 0 ? wall_dist - r : r - wall_dist;
+    collided = true;
+  }
+
+  /* Check for collisions on the x-axis */
+  if (get_axis_wall_dist(x, y, dx >= 0 ? AXIS_POS_X : AXIS_NEG_X,
+                         &wall_dist) &&
+      wall_dist < MAX(dx, -dx) + r) {
+    dx = dx >= 0 ? wall_dist - r : r - wall_dist;
+    collided = true;
+  }
+
+  pos->x = fix_to_f32(x + dx);
+  pos->y = fix_to_f32(y + dy);
+
+  return collided;
+}
+
+/* Same as the f32 version below, but the point is (@x, @y) */
+static inline
+b8 is_wall_at(fixed x, fixed y) {
+  const u32 cell_x = fix_to_int(x), cell_y = fix_to_int(y);
+  return cell_x >= g_map.w || cell_y >= g_map.h ||
+         g_map.tiles[cell_x + cell_y * g_map.w];
+}
+
+/* Same as the f32 version below */
+static
+b8 move_projectile(vec2f* pos, vec2f* diff, f32 radius) {
+  const fixed x = fix_from_f32(pos->x), y = fix_from_f32(pos->y);
+  const fixed dx = fix_from_f32(diff->x), dy = fix_from_f32(diff->y);
+  const fixed r = fix_from_f32(radius);
+  fixed edge_x, edge_y;
+
+  if (MAX(dx, -dx) >= FIX_ONE || MAX(dy, -dy) >= FIX_ONE)
+    return game_move_and_collide(pos, diff, radius);
+
+  edge_x = x + dx + (dx >= 0 ? r : -r);
+  edge_y = y + dy + (dy >= 0 ? r : -r);
+  if (is_wall_at(edge_x, edge_y) || is_wall_at(edge_x, y) ||
+      is_wall_at(x, edge_y))
+    return true;
+
+  pos->x = fix_to_f32(x + dx);
+  pos->y = fix_to_f32(y + dy);
+
+  return false;
+}
+
+/* Distance covered moving at @vel for @delta seconds */
+vec2f game_get_move_diff(const vec2f* vel, f32 delta) {
+  const fixed d = fix_from_f32(delta);
+  return (vec2f) {
+    fix_to_f32(fix_mul(fix_from_f32(vel->x), d)),
+    fix_to_f32(fix_mul(fix_from_f32(vel->y), d))
+  };
+}
+
+vec2f game_get_player_velocity(void) {
+  const fixed dir_x = fix_from_f32(g_player.dir.x);
+  const fixed dir_y = fix_from_f32(g_player.dir.y);
+  const fixed joy_x = fix_from_f32(g_joystick.x);
+  const fixed joy_y = fix_from_f32(g_joystick.y);
+  fixed v_x, v_y, len, speed;
+
+  /* Joystick direction, rotated in the direction the player is facing */
+  v_x = fix_mul(dir_x, joy_y) - fix_mul(dir_y, joy_x);
+  v_y = fix_mul(dir_y, joy_y) + fix_mul(dir_x, joy_x);
+  if ((len = fix_length(v_x, v_y)) == 0)
+    return (vec2f) {0};
+
+  /* Same as analog_input_strength(), scaled by the run speed */
+  speed = fix_mul(fix_length(joy_x, joy_y),
+                  fix_from_f32(PLAYER_RUN_SPEED * INV_SQRT2));
+
+  return (vec2f) {
+    fix_to_f32(fix_mul(fix_div(v_x, len), speed)),
+    fix_to_f32(fix_mul(fix_div(v_y, len), speed))
+  };
+}
+
+#else
+
+/* Distance from @pos to the closest wall straight along @dir. Returns false
+ * if there is no wall in the first COLL_DOF cells, the same as tracing an
+ * axis aligned ray would.
+ */
+static inline
+b8 get_axis_wall_dist(const vec2f* pos, enum axis_dir dir, f32* dist) {
+  const u32 cell_x = (i32)pos->x, cell_y = (i32)pos->y;
+  f32 frac, edge;
+  u8 steps;
+
+  /* There is nothing to collide with outside of the map */
+  if (cell_x >= g_map.w || cell_y >= g_map.h)
+    return false;
+
+  steps = g_map.axis_dist[dir][cell_x + cell_y * g_map.w];
+  if (steps >= COLL_DOF)
+    return false;
+
+  /* Distance to the side of the cell facing @dir */
+  frac = dir < AXIS_POS_Y ? pos->x - (i32)pos->x : pos->y - (i32)pos->y;
+  edge = dir == AXIS_POS_X || dir == AXIS_POS_Y ? 1.0f - frac : frac;
+
+  *dist = edge + (f32)((i32)steps - 1);
+  return true;
+}
+
+b8 game_move_and_collide(vec2f* pos, vec2f* diff, f32 radius) {
+  f32 v_dir, h_dir, v_dist, h_dist, wall_dist;
+  b8 collided = false;
+
+  /* Check for collisions on the y-axis */
+  v_dir = signf(diff->y);
   v_dist = absf(diff->y);
-  if (trace_ray(pos, &v_dir, COLL_DOF, &hit) &&
-      hit.dist < v_dist + radius) {
-    v_dist = hit.dist - radius;
+  if (get_axis_wall_dist(pos, v_dir > 0.0f ? AXIS_POS_Y : AXIS_NEG_Y,
+                         &wall_dist) &&
+      wall_dist < v_dist + radius) {
+    v_dist = wall_dist - radius;
     collided = true;
   }
 
   /* Check for collisions on the x-axis */
-  h_dir.x = signf(diff->x);
-  h_dir.y = 0.0f;
+  h_dir = signf(diff->x);
   h_dist = absf(diff->x);
-  if (trace_ray(pos, &h_dir, COLL_DOF, &hit) &&
-      hit.dist < h_dist + radius) {
-    h_dist = hit.dist - radius;
+  if (get_axis_wall_dist(pos, h_dir > 0.0f ? AXIS_POS_X : AXIS_NEG_X,
+                         &wall_dist) &&
+      wall_dist < h_dist + radius) {
+    h_dist = wall_dist - radius;
     collided = true;
   }
 
-  pos->x += h_dir.x * h_dist;
-  pos->y += v_dir.y * v_dist;
+  pos->x += h_dir * h_dist;
+  pos->y += v_dir * v_dist;
 
   return collided;
 }
 
+/* Returns true if the point (@x, @y) is inside a wall or outside the map */
+static inline
+b8 is_wall_at(f32 x, f32 y) {
+  const u32 cell_x = (i32)x, cell_y = (i32)y;
+  return cell_x >= g_map.w || cell_y >= g_map.h ||
+         g_map.tiles[cell_x + cell_y * g_map.w];
+}
+
+/* Move a projectile at @pos by @diff. Returns true if it hit a wall on the
+ * way, in which case it may not have moved at all.
+ */
+static
+b8 move_projectile(vec2f* pos, vec2f* diff, f32 radius) {
+  f32 edge_x, edge_y;
+
+  if (absf(diff->x) >= 1.0f || absf(diff->y) >= 1.0f)
+    return game_move_and_collide(pos, diff, radius);
+
+  /* Moving less than a cell along each axis, the projectile can only hit
+   * the walls around the cell it ends up in.
+   */
+  edge_x = pos->x + diff->x + signf(diff->x) * radius;
+  edge_y = pos->y + diff->y + signf(diff->y) * radius;
+  if (is_wall_at(edge_x, edge_y) || is_wall_at(edge_x, pos->y) ||
+      is_wall_at(pos->x, edge_y))
+    return true;
+
+  pos->x += diff->x;
+  pos->y += diff->y;
+
+  return false;
+}
+
+vec2f game_get_move_diff(const vec2f* vel, f32 delta) {
+  return VEC2SCALE(vel, delta);
+}
+
 vec2f game_get_player_velocity(void) {
   f32 speed;
   vec2f dir;
@@ -212,337 +584,1324 @@ vec2f game_get_player_velocity(void) {
   return VEC2SCALE(&dir, speed);
 }
 
+#endif // USE_FIXED_POINT_SIM
+
 static inline
 void update_player_position(f32 delta) {
-  vec2f vel;
+  vec2f vel, diff;
 
   /* A dead man cannot move :^) */
   if (g_player.health <= 0)
     return;
 
   vel = game_get_player_velocity();
+  diff = game_get_move_diff(&vel, delta);
 
-  game_move_and_collide(&g_player.pos,
-                        &VEC2SCALE(&vel, delta),
-                        g_sprite_radius[SPRITE_PLAYER]);
+  game_move_and_collide(&g_player.pos, &diff, g_sprite_radius[SPRITE_PLAYER]);
 }
 
 static inline
 void update_sprites(f32 delta) {
-  b8 collided;
-  u32 i, j;
-  f32 dist_from_other2, min_dist2;
-  f32 s_radius;
-  vec2f diff;
-  struct sprite *s, *other;
+  u32 i;
+  vec2f pos, vel, diff;
+  struct sprite* s;
 
+  /* Bullets are not in g_sprites, see update_projectiles(..) */
   for (i = 0; i < g_sprites.n; ++i) {
     s = g_sprites.s + i;
 
-    s_radius = g_sprite_radius[s->desc.type];
-
-    collided = game_move_and_collide(&s->pos,
-                                     &VEC2SCALE(&s->vel, delta),
-                                     s_radius);
-    /* Disable bullet sprites on collision with a wall */
-    if (s->desc.type == SPRITE_BULLET)
-      s->disabled = !s->disabled && collided;
-    else /* s->desc.type == SPRITE_PLAYER */ {
-      /* Do player sprite animation */
-      if (s->anim_frame > 4.0f) {
-        /* If anim_frame > 4, the firing frame is being shown */
-        s->anim_frame -= delta * PLAYER_ANIM_FPS;
-        if (s->anim_frame < 4.0f)
-          s->anim_frame = 4.0f;
-      }
-      else if (VEC2LENGTH2(&s->vel) > 0.01f)
-        /* Player is moving, animate */
-        s->anim_frame = modf(s->anim_frame + delta * PLAYER_ANIM_FPS, 4.0f);
-      else
-        /* Player is standing, set the correct animation frame */
+    pos = (vec2f) { g_sprites.x[i], g_sprites.y[i] };
+    vel = (vec2f) { g_sprites.vel_x[i], g_sprites.vel_y[i] };
+    diff = game_get_move_diff(&vel, delta);
+    game_move_and_collide(&pos, &diff, g_sprite_radius[s->desc.type]);
+    g_sprites.x[i] = pos.x;
+    g_sprites.y[i] = pos.y;
+    game_grid_update(i);
+
+    /* Do player sprite animation */
+    if (s->anim_frame > 4.0f) {
+      /* If anim_frame > 4, the firing frame is being shown */
+      s->anim_frame -= delta * PLAYER_ANIM_FPS;
+      if (s->anim_frame < 4.0f)
         s->anim_frame = 4.0f;
     }
+    else if (VEC2LENGTH2(&vel) > 0.01f)
+      /* Player is moving, animate */
+      s->anim_frame = modf(s->anim_frame + delta * PLAYER_ANIM_FPS, 4.0f);
+    else
+      /* Player is standing, set the correct animation frame */
+      s->anim_frame = 4.0f;
+  }
+}
 
-    /* If the sprite is disabled or the sprite is not a player,
-     * do not do collision checks with other sprites.
-     */
-    if (s->disabled || s->desc.type != SPRITE_PLAYER)
-      continue;
+/* Resolve @handle, returns NULL if its sprite has been destroyed */
+struct sprite* game_get_sprite(struct sprite_handle handle) {
+  u32 slot = g_sprites.slots[handle.id];
+  if (!(handle.gen & 1) || handle.gen != g_sprites.gens[handle.id] || !slot)
+    return NULL;
+  return &g_sprites.s[slot - 1];
+}
 
-    for (j = 0; j < g_sprites.n; ++j) {
-      other = g_sprites.s + j;
+struct sprite_handle game_get_sprite_handle(const struct sprite* s) {
+  return (struct sprite_handle) {
+    .gen = g_sprites.gens[s->desc.id],
+    .id = s->desc.id
+  };
+}
 
-      if (other->disabled || other == s)
-        continue;
+/* Sprites bucketed by the map tile they are in, so that overlap tests only
+ * have to look at the sprites in the tiles around a point. Each tile holds a
+ * doubly linked list of sprite ids, kept up to date as sprites move.
+ */
+static struct {
+  /* Id + 1 of the first sprite in each tile, 0 if the tile is empty */
+  u16 head[MAX_MAP_WIDTH * MAX_MAP_HEIGHT];
+  /* Id + 1 of the sprites before and after each one in its tile */
+  u16 prev[MAX_SPRITE_IDS], next[MAX_SPRITE_IDS];
+  /* Tile + 1 each sprite is in, 0 if it is not in the grid */
+  u16 tile[MAX_SPRITE_IDS];
+} g_sprite_grid;
+
+/* Grid tile containing the point (@x, @y), points outside of the map are
+ * clamped to the closest tile.
+ */
+static inline
+u32 grid_tile(f32 x, f32 y) {
+  const i32 tile_x = MIN(MAX((i32)x, 0), MAX_MAP_WIDTH - 1);
+  const i32 tile_y = MIN(MAX((i32)y, 0), MAX_MAP_HEIGHT - 1);
+  return tile_x + tile_y * MAX_MAP_WIDTH;
+}
 
-      /* Since we already need to compute dist_from_player2 we might as well
-       * save the diff vector, because we'll also need it during rendering.
-       */
-      diff = VEC2SUB(&other->pos, &s->pos);
+static inline
+void grid_link(u8 id, u32 tile) {
+  const u16 head = g_sprite_grid.head[tile];
+  g_sprite_grid.prev[id] = 0;
+  g_sprite_grid.next[id] = head;
+  if (head)
+    g_sprite_grid.prev[head - 1] = id + 1;
+  g_sprite_grid.head[tile] = id + 1;
+  g_sprite_grid.tile[id] = tile + 1;
+}
 
-      /* Compute minimum distance between the two sprites */
-      min_dist2 = s_radius + g_sprite_radius[other->desc.id];
-      min_dist2 *= min_dist2;
+static inline
+void grid_unlink(u8 id) {
+  const u16 prev = g_sprite_grid.prev[id], next = g_sprite_grid.next[id];
+  if (prev)
+    g_sprite_grid.next[prev - 1] = next;
+  else
+    g_sprite_grid.head[g_sprite_grid.tile[id] - 1] = next;
+  if (next)
+    g_sprite_grid.prev[next - 1] = prev;
+  g_sprite_grid.tile[id] = 0;
+}
 
-      /* Compute the distance from the player and check if the
-       * sprite collided.
-       */
-      dist_from_other2 = VEC2LENGTH2(&diff);
-      if (dist_from_other2 < min_dist2) {
-        if (other->desc.type == SPRITE_BULLET &&
-            other->desc.owner != s->desc.id)
-          /* Disable the bullet sprite if it collided with a player sprite */
-          other->disabled = true;
+/* Insert the sprite in @slot into the sprite grid, or move it to the tile it
+ * is in now.
+ */
+void game_grid_update(u32 slot) {
+  const u8 id = g_sprites.s[slot].desc.id;
+  const u32 tile = grid_tile(g_sprites.x[slot], g_sprites.y[slot]);
+  if (g_sprite_grid.tile[id] == tile + 1)
+    return;
+  if (g_sprite_grid.tile[id])
+    grid_unlink(id);
+  grid_link(id, tile);
+}
+
+/* Remove the sprite with the requested @id from the sprite grid */
+void game_grid_remove(u8 id) {
+  if (g_sprite_grid.tile[id])
+    grid_unlink(id);
+}
+
+/* Rebuild the sprite grid from scratch, from the contents of g_sprites */
+void game_grid_rebuild(void) {
+  u32 i;
+  memset(&g_sprite_grid, 0, sizeof(g_sprite_grid));
+  for (i = 0; i < g_sprites.n; ++i)
+    game_grid_update(i);
+}
+
+/* Returns true if a sprite, other than the one with id @owner, is less than
+ * @min_dist away from the point (@x, @y).
+ */
+static
+b8 hits_sprite(f32 x, f32 y, u8 owner, f32 min_dist) {
+  const u32 x_start = grid_tile(x - min_dist, 0.0f);
+  const u32 x_end = grid_tile(x + min_dist, 0.0f);
+  const u32 y_start = grid_tile(0.0f, y - min_dist);
+  const u32 y_end = grid_tile(0.0f, y + min_dist);
+  u32 row, tile, slot;
+  u16 id;
+  f32 dx, dy;
+  struct sprite* s;
+
+  for (row = y_start; row <= y_end; row += MAX_MAP_WIDTH) {
+    for (tile = row + x_start; tile <= row + x_end; ++tile) {
+      for (id = g_sprite_grid.head[tile]; id; id = g_sprite_grid.next[id - 1]) {
+        slot = g_sprites.slots[id - 1] - 1;
+        s = &g_sprites.s[slot];
+        if (s->disabled || s->desc.id == owner)
+          continue;
+        dx = g_sprites.x[slot] - x;
+        dy = g_sprites.y[slot] - y;
+        if (dx * dx + dy * dy < min_dist * min_dist)
+          return true;
       }
     }
   }
 
-  UNUSED(delta);
+  return false;
+}
+
+static inline
+void update_projectiles(f32 delta) {
+  const f32 radius = g_sprite_radius[SPRITE_BULLET];
+  const f32 min_dist = g_sprite_radius[SPRITE_PLAYER] + radius;
+  vec2f pos, vel, diff;
+  u32 i;
+
+  /* Move the projectiles in a straight line, and disable the ones that hit
+   * a wall on the way.
+   */
+  for (i = 0; i < g_projectiles.n; ++i) {
+    if (g_projectiles.disabled[i])
+      continue;
+
+    pos = (vec2f) { g_projectiles.x[i], g_projectiles.y[i] };
+    vel = (vec2f) { g_projectiles.vel_x[i], g_projectiles.vel_y[i] };
+    diff = game_get_move_diff(&vel, delta);
+
+    g_projectiles.disabled[i] = move_projectile(&pos, &diff, radius);
+    g_projectiles.x[i] = pos.x;
+    g_projectiles.y[i] = pos.y;
+  }
+
+  /* Disable the projectiles that hit a player, other than the one that
+   * fired them.
+   */
+  for (i = 0; i < g_projectiles.n; ++i) {
+    if (!g_projectiles.disabled[i])
+      g_projectiles.disabled[i] =
+        hits_sprite(g_projectiles.x[i], g_projectiles.y[i],
+                    g_projectiles.owner[i], min_dist);
+  }
 }
 
 void game_update(f32 delta) {
   update_player_position(delta);
   update_sprites(delta);
+  update_projectiles(delta);
+}
+
+/* Fill rows [@from, @to) of @column with the background (sky on the top half
+ * of the view, floor on the bottom half).
+ */
+static inline
+void fill_background(u32* column, i32 from, i32 to) {
+  i32 y, mid = g_view.h >> 1;
+  for (y = from; y < MIN(to, mid); ++y)
+    column[y] = g_background.sky;
+  for (y = MAX(from, mid); y < to; ++y)
+    column[y] = g_background.floor;
 }
 
 static
 void draw_column(u8 cell_id, i32 x, const struct hit* hit) {
   i32 y, line_y, line_height;
   u32 line_color;
+  u32* column;
+  struct span* dirty;
 
   /* Draw column */
   if (cell_id) {
     line_color = hit->vertical ? COLOR(WHITE) : COLOR(LIGHTGRAY);
 
-    line_height = FB_HEIGHT / hit->dist;
-    if ((u32)line_height > FB_HEIGHT)
-      line_height = FB_HEIGHT;
-    line_y = (FB_HEIGHT - line_height) >> 1;
-  } else
-    line_y = FB_HEIGHT >> 1;
-
-  /* Fill column */
-  y = 0;
-  for (; y < line_y; ++y)
-    fb_set_pixel(x, y, COLOR(BLUE));
-  if (cell_id) {
-    line_y += line_height;
-    for (; y < line_y; ++y)
-      fb_set_pixel(x, y, line_color);
+    line_height = g_view.h / hit->dist;
+    if ((u32)line_height > g_view.h)
+      line_height = g_view.h;
+    line_y = (g_view.h - line_height) >> 1;
+  } else {
+    line_color = 0;
+    line_height = 0;
+    line_y = g_view.h >> 1;
   }
-  for (; y < (i32)FB_HEIGHT; ++y)
-    fb_set_pixel(x, y, COLOR(BLACK));
+
+  /* The rest of the column already holds the background, so only restore it
+   * where the last frame drew something the new wall does not cover.
+   */
+  column = cb_get_column(x);
+  dirty = &g_dirty_spans[x];
+  fill_background(column, dirty->top, MIN(dirty->bottom, line_y));
+  fill_background(column, MAX(dirty->top, line_y + line_height), dirty->bottom);
+
+  /* Fill wall span */
+  for (y = line_y; y < line_y + line_height; ++y)
+    column[y] = line_color;
+
+  dirty->top = line_y;
+  dirty->bottom = line_y + line_height;
+}
+
+/* Slots [0, MAX_SPRITES) are the sprites in g_sprites, the slots after
+ * them are the projectiles in g_projectiles.
+ */
+#define MAX_SLOTS (MAX_SPRITES + MAX_PROJECTILES)
+#define PROJECTILE_SLOT(i) (MAX_SPRITES + (i))
+
+/* Where every slot lands on the screen this frame. Only the renderer needs
+ * it, so it is kept out of struct sprite, one array per field so that
+ * project_sprites(..) streams through it.
+ */
+static struct {
+  /* Position relative to the camera, in camera space */
+  f32 cam_x[MAX_SLOTS];
+  f32 cam_y[MAX_SLOTS];
+  /* Half of the sprite width times its depth */
+  f32 halfw[MAX_SLOTS];
+  b8 in_view[MAX_SLOTS];
+  i32 screen_x[MAX_SLOTS];
+  i32 screen_halfw[MAX_SLOTS];
+  f32 inv_depth[MAX_SLOTS];
+  f32 depth2[MAX_SLOTS];
+  f32 rel_rot[MAX_SLOTS];
+} g_sprite_proj;
+
+static inline
+enum sprite_type get_slot_type(u32 slot) {
+  return slot < MAX_SPRITES ? g_sprites.s[slot].desc.type : SPRITE_BULLET;
 }
 
 static inline
-i32 get_y_end(struct sprite* s, u32 screen_h) {
-  switch (s->desc.type) {
+i32 get_y_end(u32 slot, enum sprite_type type, u32 screen_h) {
+  switch (type) {
     case SPRITE_BULLET:
       /* We add a little offset to the bullet's vertical height so
        * that it doesn't come out of the player camera.
        */
-      return (FB_HEIGHT + screen_h +
-              (i32)((f32)BULLET_SCREEN_OFF * s->inv_depth)) >> 1;
+      return (g_view.h + screen_h +
+              (i32)((f32)BULLET_SCREEN_OFF * g_view.scale_y *
+                    g_sprite_proj.inv_depth[slot]))
+             >> 1;
     default:
       /* By default, place objects on the ground */
-      return (f32)(FB_HEIGHT >> 1) * (1.0f + s->inv_depth);
+      return (f32)(g_view.h >> 1) * (1.0f + g_sprite_proj.inv_depth[slot]);
   }
 }
 
+/* Pick the tile of the player spritesheet that faces the camera */
 static inline
-const u8* get_player_tile(u32 x, u32 y) {
-  return &g_player_spritesheet[((y * PLAYER_NTILES_W) + x) *
-                               (PLAYER_TILE_W * PLAYER_TILE_H)];
-}
-
-static
-void get_texture_info(struct sprite* s, b8* invert_x, u32* tex_w, u32* tex_h,
-                      const u8** tex, const u32** coltab) {
+u32 get_player_tile(u32 slot, b8* invert_x) {
+  const struct sprite* s = &g_sprites.s[slot];
   i32 rot;
 
-  *invert_x = false;
-
-  /* Do sprite specific stuff */
-  if (s->desc.type == SPRITE_PLAYER) {
-    /* Set the player sprite data */
 #define STEPS ((PLAYER_NTILES_H << 1) - 2)
 #define SLICE (TWO_PI / STEPS)
-    /* Determine the rotation of the sprite to use */
-    rot = (s->rot + SLICE / 2.0f - s->rel_rot + PI) * STEPS / TWO_PI;
-    rot &= 7;
-    if (rot > 4) {
-      rot = 8 - rot;
-      *invert_x = true;
+  /* Determine the rotation of the sprite to use */
+  rot = (s->rot + SLICE / 2.0f - g_sprite_proj.rel_rot[slot] + PI) * STEPS /
+        TWO_PI;
+  rot &= 7;
+  if (rot > 4) {
+    rot = 8 - rot;
+    *invert_x = true;
+  }
+  /* Get the index of the corresponding sprite tile */
+  return abs(rot) * PLAYER_NTILES_W + (u32)s->anim_frame;
+}
+
+/* Steps through floor(i * num / den) for evenly spaced values of i, with
+ * integer adds only. This gives the same texture coordinates as computing
+ * them with a divide for every pixel.
+ */
+struct tex_step {
+  u32 value, rem; /* Quotient and remainder at the current i */
+  u32 q, r;       /* Quotient and remainder of a single step */
+  u32 den;
+};
+
+static inline
+void tex_step_init(struct tex_step* t, u32 start, u32 step, u32 num, u32 den) {
+  t->value = (start * num) / den;
+  t->rem = (start * num) % den;
+  t->q = (step * num) / den;
+  t->r = (step * num) % den;
+  t->den = den;
+}
+
+static inline
+void tex_step_next(struct tex_step* t) {
+  t->value += t->q;
+  t->rem += t->r;
+  if (t->rem >= t->den) {
+    t->rem -= t->den;
+    ++t->value;
+  }
+}
+
+#define MAX_TEXTURE_H MAX(PLAYER_TILE_H, BULLET_TEXTURE_H)
+
+#ifdef USE_FRONT_TO_BACK_SPRITES
+/* One bit per pixel of the 3D view, set once a sprite has drawn it */
+#define COVERAGE_WORDS ((FB_HEIGHT + 31) >> 5)
+static u32 g_sprite_coverage[FB_WIDTH][COVERAGE_WORDS];
+
+/* Draw the rows [@y, @y_end) of a sprite column that no nearer sprite has
+ * drawn yet, and mark them as drawn. @column and @rows start at row
+ * @y_first, as in rasterize_sprite.
+ */
+static ALWAYS_INLINE
+void draw_uncovered_rows(u32* column, u32* coverage, i32 y, i32 y_end,
+                         i32 y_first, const u8* texcol, const u32* rows,
+                         const u32* coltab, u32 a) {
+  u32 mask, bits;
+  i32 base, end, i;
+
+  for (; y < y_end; y = end) {
+    base = y & ~31;
+    end = MIN(y_end, base + 32);
+    mask = (~0U << (y - base)) & (~0U >> (base + 32 - end));
+    bits = mask & ~coverage[base >> 5];
+    coverage[base >> 5] |= mask;
+    for (; bits != 0; bits &= bits - 1) {
+      i = base + ctz(bits) - y_first;
+      column[i] = coltab[texcol[rows[i]]] | a;
     }
-    /* Get the pointer to the corresponding sprite texture */
-    *tex = get_player_tile((u32)s->anim_frame, abs(rot));
-    /* Set the color table pointer */
-    *coltab = g_player_coltab;
-    /* Set the texture width and height */
-    *tex_w = PLAYER_TILE_W;
-    *tex_h = PLAYER_TILE_H;
-  } else /* s->desc.type == SPRITE_BULLET */ {
-    /* Set the bullet sprite data */
-    *tex = g_bullet_texture;
-    *coltab = g_bullet_coltab;
-    /* Set bullet texture dimensions */
-    *tex_w = BULLET_TEXTURE_W;
-    *tex_h = BULLET_TEXTURE_H;
   }
 }
+#endif
 
+/* Columns [start, end) of the screen */
+struct column_range {
+  i32 start, end;
+};
+
+/* Split the columns [@x_first, @x_last) rendered this frame into the ranges
+ * where a sprite at @depth2 is not hidden behind a wall, and return how many
+ * there are. Whole depth tiles are accepted or rejected at once, only the
+ * columns of the tiles a wall partially covers are tested one by one.
+ */
 static
-void draw_sprite(struct sprite* s) {
-  u32 screen_h, color, a;
-  u32 tex_w, tex_h;
-  u32 uvw, uvh, uvx, uvy;
-  i32 x_start, x_end, y_start, y_end;
-  i32 x, y;
-  const u8* tex;
-  const u32* coltab;
-  b8 invert_x = false;
+u32 get_visible_ranges(f32 depth2, i32 x_first, i32 x_last,
+                       struct column_range* ranges) {
+  const i32 step = g_interlace.step;
+  const struct zb_tile* tile;
+  i32 x, tile_end;
+  u32 n = 0;
+  b8 open = false;
+
+  for (x = x_first; x < x_last; x = first_column(tile_end)) {
+    tile = zb_get_tile(x);
+    tile_end = MIN((x / ZB_TILE + 1) * ZB_TILE, x_last);
+    if (tile->max < depth2) {
+      /* Every column of the tile is hidden */
+      n += open;
+      open = false;
+    } else if (tile->min >= depth2) {
+      /* Every column of the tile is visible */
+      if (!open)
+        ranges[n].start = x;
+      ranges[n].end = tile_end;
+      open = true;
+    } else {
+      for (; x < tile_end; x += step) {
+        if (zb_get_depth(x) < depth2) {
+          n += open;
+          open = false;
+          continue;
+        }
+        if (!open)
+          ranges[n].start = x;
+        ranges[n].end = x + 1;
+        open = true;
+      }
+    }
+  }
 
-  screen_h = (f32)g_sprite_dims[s->desc.type].y * s->inv_depth;
+  return n + open;
+}
+
+/* Draw the columns of the sprite in slot @slot, @screen_h pixels tall, that fall
+ * inside the strip [@strip_start, @strip_end) of the screen, using mip
+ * @level of texture @tex. Only the opaque runs of each texture column are drawn, as
+ * listed by @span_index (see gen_span_tables in gen-sprites.py).
+ *
+ * NOTE: This is always inlined with constant @type, @level and @invert_x
+ *       (see SPRITE_RASTERIZER), so that the texture dimensions and color
+ *       table are known at compile time and the mirroring test goes away.
+ */
+static ALWAYS_INLINE
+void rasterize_sprite(u32 slot, const u8* tex, const u16* span_index,
+                      u32 screen_h, i32 strip_start, i32 strip_end,
+                      enum sprite_type type, u32 level, b8 invert_x) {
+  const u32 tex_w =
+    type == SPRITE_PLAYER ? g_player_mip_w[level] : g_bullet_mip_w[level];
+  const u32 tex_h =
+    type == SPRITE_PLAYER ? g_player_mip_h[level] : g_bullet_mip_h[level];
+  const u32* const coltab =
+    type == SPRITE_PLAYER ? g_player_coltab : g_bullet_coltab;
+  const u8* const spans =
+    type == SPRITE_PLAYER ? g_player_spans[level] : g_bullet_spans[level];
+  u32 a, i, t, n_rows;
+  u32 uvw, uvh;
+  u32 rows[FB_HEIGHT];
+  u32 ys[MAX_TEXTURE_H + 1];
+  u32 r, n_ranges;
+  struct column_range ranges[FB_WIDTH / 2];
+  i32 x_start, x_end, y_start, y_end;
+  i32 x, y, run_end, x_first, x_last, y_first, y_last;
+  u32* column;
+  const u8* texcol;
+  struct span* dirty;
+  struct tex_step u, v;
 
   /* Determine screen coordinates of the sprite */
-  x_start = s->screen_x - s->screen_halfw;
-  x_end = s->screen_x + s->screen_halfw;
-  y_end = get_y_end(s, screen_h);
+  x_start = g_sprite_proj.screen_x[slot] - g_sprite_proj.screen_halfw[slot];
+  x_end = g_sprite_proj.screen_x[slot] + g_sprite_proj.screen_halfw[slot];
+  y_end = get_y_end(slot, type, screen_h);
   y_start = y_end - screen_h;
 
   /* Compute the sprite width and height on the screen */
   uvw = MAX(x_end - x_start, 0);
   uvh = MAX(y_end - y_start, 0);
 
-  get_texture_info(s, &invert_x, &tex_w, &tex_h, &tex, &coltab);
+  /* Clip the sprite against the strip and the screen */
+  x_first = first_column(MAX(strip_start, x_start));
+  x_last = MIN(x_end, strip_end);
+  y_first = MAX(0, y_start);
+  y_last = MIN(y_end, (i32)g_view.h);
+  if (x_first >= x_last || y_first >= y_last)
+    return;
+
+  /* Skip the sprite if it is hidden behind walls */
+  n_ranges =
+    get_visible_ranges(g_sprite_proj.depth2[slot], x_first, x_last, ranges);
+  if (n_ranges == 0)
+    return;
+
+  /* Every column reads the same texture rows. ys[t] is the first row that
+   * reads texture row @t or below, so that the texture rows [start, end)
+   * cover the rows [ys[start], ys[end]) of the column.
+   */
+  n_rows = y_last - y_first;
+  tex_step_init(&v, y_first - y_start, 1, tex_h, uvh);
+  for (y = 0, t = 0; y < (i32)n_rows; ++y) {
+    rows[y] = v.value * tex_w;
+    while (t <= v.value)
+      ys[t++] = y;
+    tex_step_next(&v);
+  }
+  while (t <= tex_h)
+    ys[t++] = n_rows;
 
   a = color_get_alpha_mask();
-  /* Draw the sprite */
-  for (x = MAX(0, x_start); x < x_end && x < (i32)FB_WIDTH; x++) {
-    /* Discard stripe if there's a wall closer to the camera */
-    if (zb_get_depth(x) < s->depth2)
-      continue;
-    /* Compute x texture coordinate */
-    uvx = (f32)((x - x_start) * tex_w) / uvw;
-    /* Invert on the x axis if needed */
-    if (invert_x)
-      uvx = tex_w - uvx;
-    for (y = MAX(0, y_start); y < y_end && y < (i32)FB_HEIGHT; y++) {
-      uvy = (f32)((y - y_start) * tex_h) / uvh;
-      color = tex[uvx + uvy * tex_w];
-      if (color)
-        fb_set_pixel(x, y, coltab[color] | a);
+  /* Draw the visible columns of the sprite */
+  for (r = 0; r < n_ranges; ++r) {
+    tex_step_init(&u, ranges[r].start - x_start, g_interlace.step, tex_w, uvw);
+    for (x = ranges[r].start; x < ranges[r].end;
+         x += g_interlace.step, tex_step_next(&u)) {
+      /* Invert on the x axis if needed */
+      t = invert_x ? tex_w - 1 - u.value : u.value;
+      texcol = tex + t;
+      column = cb_get_column(x) + y_first;
+      /* Walk the opaque runs of the texture column */
+      for (i = span_index[t]; i < span_index[t + 1]; ++i) {
+        run_end = ys[spans[2 * i + 1]];
+#ifdef USE_FRONT_TO_BACK_SPRITES
+        draw_uncovered_rows(column, g_sprite_coverage[x],
+                            y_first + ys[spans[2 * i]], y_first + run_end,
+                            y_first, texcol, rows, coltab, a);
+#else
+        for (y = ys[spans[2 * i]]; y < run_end; ++y)
+          column[y] = coltab[texcol[rows[y]]] | a;
+#endif
+      }
+      /* Mark the rows the sprite may have drawn over */
+      dirty = &g_dirty_spans[x];
+      dirty->top = MIN(dirty->top, y_first);
+      dirty->bottom = MAX(dirty->bottom, y_last);
     }
   }
 }
 
+typedef void (*sprite_rasterizer_t)(u32, const u8*, const u16*, u32, i32,
+                                    i32);
+
+#define SPRITE_RASTERIZER(name, type, level, invert_x)                      \
+  static                                                                    \
+  void name(u32 slot, const u8* tex, const u16* span_index, u32 screen_h,  \
+            i32 strip_start, i32 strip_end) {                               \
+    rasterize_sprite(slot, tex, span_index, screen_h, strip_start,          \
+                     strip_end, type, level, invert_x);                     \
+  }
+
+#define SPRITE_RASTERIZERS(level)                                           \
+  SPRITE_RASTERIZER(draw_player_##level, SPRITE_PLAYER, level, false)       \
+  SPRITE_RASTERIZER(draw_player_mirrored_##level, SPRITE_PLAYER, level, true) \
+  SPRITE_RASTERIZER(draw_bullet_##level, SPRITE_BULLET, level, false)
+
+#if MIP_LEVELS != 4
+#error "there must be one set of rasterizers per mip level"
+#endif
+SPRITE_RASTERIZERS(0)
+SPRITE_RASTERIZERS(1)
+SPRITE_RASTERIZERS(2)
+SPRITE_RASTERIZERS(3)
+
+/* Indexed by sprite type, mip level and mirroring */
+static const sprite_rasterizer_t
+g_sprite_rasterizers[SPRITE_MAX][MIP_LEVELS][2] = {
+  [SPRITE_PLAYER] = {
+    { draw_player_0, draw_player_mirrored_0 },
+    { draw_player_1, draw_player_mirrored_1 },
+    { draw_player_2, draw_player_mirrored_2 },
+    { draw_player_3, draw_player_mirrored_3 }
+  },
+  /* Bullets are never mirrored */
+  [SPRITE_BULLET] = {
+    { draw_bullet_0, draw_bullet_0 },
+    { draw_bullet_1, draw_bullet_1 },
+    { draw_bullet_2, draw_bullet_2 },
+    { draw_bullet_3, draw_bullet_3 }
+  }
+};
+
+/* Pick the smallest mip level that is still at least @screen_h texels tall,
+ * so that distant sprites read fewer, closer texels without ever being
+ * magnified more than needed.
+ */
+static inline
+u32 get_mip_level(const u32* mip_h, u32 screen_h) {
+  u32 level = 0;
+  while (level < MIP_LEVELS - 1 && mip_h[level + 1] >= screen_h)
+    ++level;
+  return level;
+}
+
 static inline
-void render_scene(void) {
-  u8 cell_id;
-  i32 x;
-  f32 cam_x;
+void draw_sprite(u32 slot, i32 strip_start, i32 strip_end) {
+  const enum sprite_type type = get_slot_type(slot);
+  const u8* tex;
+  const u16* span_index;
+  u32 screen_h, level, tile;
+  b8 invert_x = false;
+
+  screen_h =
+    (f32)g_sprite_dims[type].y * g_view.scale_y *
+    g_sprite_proj.inv_depth[slot];
+
+  if (type == SPRITE_PLAYER) {
+    level = get_mip_level(g_player_mip_h, screen_h);
+    tile = get_player_tile(slot, &invert_x);
+    tex = g_player_mips[level] +
+          tile * g_player_mip_w[level] * g_player_mip_h[level];
+    span_index = g_player_span_index[level] + tile * g_player_mip_w[level];
+  } else /* type == SPRITE_BULLET */ {
+    level = get_mip_level(g_bullet_mip_h, screen_h);
+    tex = g_bullet_mips[level];
+    span_index = g_bullet_span_index[level];
+  }
+
+  g_sprite_rasterizers[type][level][invert_x](slot, tex, span_index, screen_h,
+                                              strip_start, strip_end);
+}
+
+/* Returns true if every column has to be redrawn */
+static inline
+b8 update_view(void) {
+  u32 x;
+
+  g_view.w = cb_width();
+  g_view.h = cb_height();
+  g_view.scale_x = (f32)g_view.w / FB_WIDTH;
+  g_view.scale_y = (f32)g_view.h / FB_HEIGHT;
+
+  /* If the background changed (e.g. a new alpha or resolution), every row
+   * of every column has to be redrawn.
+   */
+  if (g_background.sky != COLOR(BLUE) || g_background.floor != COLOR(BLACK) ||
+      g_background.w != g_view.w || g_background.h != g_view.h) {
+    g_background.sky = COLOR(BLUE);
+    g_background.floor = COLOR(BLACK);
+    g_background.w = g_view.w;
+    g_background.h = g_view.h;
+    for (x = 0; x < g_view.w; ++x)
+      g_dirty_spans[x] = (struct span) { .top = 0, .bottom = g_view.h };
+    return true;
+  }
+
+  return false;
+}
+
+/* Upper bound on how far walls may have moved on screen, in pixels, since
+ * the last frame if the camera moved by @diff. Nothing on screen is closer
+ * than the walls around the camera cell (see game_build_map_distances).
+ */
+static inline
+f32 get_move_error(const vec2f* diff) {
+  const u32 cell_x = (u32)g_camera.pos.x, cell_y = (u32)g_camera.pos.y;
+  const f32 move2 = VEC2LENGTH2(diff);
+  f32 near, move;
+
+  if (move2 == 0.0f)
+    return 0.0f;
+  if (cell_x >= g_map.w || cell_y >= g_map.h)
+    return INTERLACE_MAX_ERROR + 1.0f;
+
+  move = 1.0f / inv_sqrt(move2);
+  near = MAX((f32)g_map.dist[cell_x + cell_y * g_map.w] - 1.0f,
+             g_sprite_radius[SPRITE_PLAYER]);
+  /* Moving sideways shifts a wall at distance near by move / near in camera
+   * space, moving towards it grows its column by about h * move / near^2
+   * rows (half of that on each end).
+   */
+  return MAX((f32)g_view.w * move / (2.0f * g_camera.plane_halfw * near),
+             (f32)g_view.h * move / (2.0f * near * near));
+}
+
+static inline
+void copy_column(i32 dst, i32 src) {
+  const struct span from = g_dirty_spans[src], to = g_dirty_spans[dst];
+  const u32* src_column = cb_get_column(src);
+  u32* dst_column = cb_get_column(dst);
+  i32 y;
+
+  /* Rows outside of both dirty spans hold the same background */
+  for (y = MIN(from.top, to.top); y < MAX(from.bottom, to.bottom); ++y)
+    dst_column[y] = src_column[y];
+  g_dirty_spans[dst] = from;
+  zb_set_depth(dst, zb_get_depth(src));
+}
+
+/* Move each column that is not rendered this frame to the one showing the
+ * same ray on the last frame. Turning moves every column the same way, so
+ * the columns are walked in the order that reads each one before it gets
+ * overwritten. Rays that were outside of the last frame are left to
+ * fill_stale_columns.
+ */
+static inline
+void reproject_columns(void) {
+  const vec2f dir = g_interlace.dir, plane = g_interlace.plane;
+  const f32 det = dir.x * plane.y - dir.y * plane.x;
+  const i32 w = g_view.w;
+  i32 x, dx;
+  f32 cam_x, den, col;
   vec2f ray_dir;
-  struct hit hit;
 
+  /* Columns move right if the camera turned left */
+  x = (w - 1) - (((w - 1) ^ g_interlace.parity ^ 1) & 1);
+  dx = -2;
+  if (g_player.dir.x * dir.y - g_player.dir.y * dir.x <= 0.0f) {
+    x = g_interlace.parity ^ 1;
+    dx = 2;
+  }
+
+  for (; x >= 0 && x < w; x += dx) {
+    cam_x = 2.0f * x / (f32)w - 1.0f;
+    ray_dir.x = g_player.dir.x + g_camera.plane.x * cam_x;
+    ray_dir.y = g_player.dir.y + g_camera.plane.y * cam_x;
+    /* Same as in lookup_column */
+    den = ray_dir.x * plane.y - ray_dir.y * plane.x;
+    col = -1.0f;
+    if (den * det > 0.0f) {
+      cam_x = (ray_dir.y * dir.x - ray_dir.x * dir.y) / den;
+      col = (cam_x + 1.0f) * 0.5f * (f32)w + 0.5f;
+    }
+
+    if (col >= 0.0f && col < (f32)w) {
+      if ((i32)col != x)
+        copy_column(x, (i32)col);
+    } else {
+      /* Every column further along was out of view too */
+      g_interlace.stale_start = dx > 0 ? x : 0;
+      g_interlace.stale_end = dx > 0 ? w : x + 1;
+      break;
+    }
+  }
+}
+
+/* Pick the columns to render this frame */
+static inline
+void update_interlacing(b8 redraw) {
+  f32 rot, max_rot;
+  vec2f move;
+
+  rot = absf(g_player.rot - g_interlace.rot);
+  rot = MIN(rot, TWO_PI - rot);
+  /* Columns are about 2 * plane_halfw / w radians apart */
+  max_rot = INTERLACE_MAX_SHIFT * 2.0f * g_camera.plane_halfw / g_view.w;
+  move.x = g_camera.pos.x - g_interlace.pos.x;
+  move.y = g_camera.pos.y - g_interlace.pos.y;
+
+  redraw |= !g_interlace.enabled || rot > max_rot ||
+            g_camera.plane_halfw != g_interlace.plane_halfw ||
+            get_move_error(&move) > INTERLACE_MAX_ERROR;
+
+  g_interlace.step = redraw ? 1 : 2;
+  g_interlace.parity ^= 1;
+  g_interlace.stale_start = 0;
+  g_interlace.stale_end = 0;
+  if (!redraw && rot > 0.0f)
+    reproject_columns();
+  g_interlace.rot = g_player.rot;
+  g_interlace.pos = g_camera.pos;
+  g_interlace.dir = g_player.dir;
+  g_interlace.plane = g_camera.plane;
+  g_interlace.plane_halfw = g_camera.plane_halfw;
+}
+
+static inline
+void update_camera(void) {
+  const vec2f pos = get_player_draw_pos();
   if (g_camera.smoothing) {
     /* Interpolate camera position with real position */
-    g_camera.pos.x = lerp(CAMERA_POS_INTERP, g_camera.pos.x, g_player.pos.x);
-    g_camera.pos.y = lerp(CAMERA_POS_INTERP, g_camera.pos.y, g_player.pos.y);
+    g_camera.pos.x = lerp(CAMERA_POS_INTERP, g_camera.pos.x, pos.x);
+    g_camera.pos.y = lerp(CAMERA_POS_INTERP, g_camera.pos.y, pos.y);
   } else
-    g_camera.pos = g_player.pos;
+    g_camera.pos = pos;
+}
 
-  for (x = 0; x < (i32)FB_WIDTH; ++x) {
-    /* Compute ray direction */
-    cam_x = (2.0f * ((f32)x / FB_WIDTH)) - 1.0f;
-    ray_dir.x = g_player.dir.x + g_camera.plane.x * cam_x;
-    ray_dir.y = g_player.dir.y + g_camera.plane.y * cam_x;
-    /* Trace ray with DDA */
-    cell_id = trace_ray(&g_camera.pos, &ray_dir, g_camera.dof, &hit);
-    /* Store distance (squared) in z-buffer */
-    zb_set_depth(x, hit.dist * hit.dist);
+/* A column of the 3D view, along with the ray traced through it */
+struct traced_column {
+  i32 x;
+  u8 cell_id;
+  struct hit hit;
+};
+
+/* Faces hit by the columns of a frame. When the camera has not moved since
+ * the last frame (e.g. the player is only looking around), most rays can be
+ * resolved from the last frame's faces instead of being traced again.
+ */
+struct ray_cache {
+  b8 valid;
+  u32 w, dof;
+  u32 step, parity; /* Columns rendered (see g_interlace) */
+  f32 det;
+  vec2f pos, dir, plane;
+  struct traced_column columns[FB_WIDTH];
+};
+
+static struct ray_cache g_ray_caches[2];
+/* Cache being filled by the current frame */
+static struct ray_cache* g_ray_cache = &g_ray_caches[0];
+/* Last frame's cache, NULL if its rays cannot be reused */
+static const struct ray_cache* g_last_ray_cache;
+
+/* Must be called once per frame, before rendering any strip */
+static inline
+void update_ray_cache(void) {
+  struct ray_cache* last = g_ray_cache;
+
+  g_ray_cache = last == &g_ray_caches[0] ? &g_ray_caches[1] : &g_ray_caches[0];
+  g_last_ray_cache = last->valid && last->dof == g_camera.dof &&
+                     last->pos.x == g_camera.pos.x &&
+                     last->pos.y == g_camera.pos.y ? last : NULL;
+
+  g_ray_cache->valid = true;
+  g_ray_cache->w = g_view.w;
+  g_ray_cache->step = g_interlace.step;
+  g_ray_cache->parity = g_interlace.parity;
+  g_ray_cache->dof = g_camera.dof;
+  g_ray_cache->pos = g_camera.pos;
+  g_ray_cache->dir = g_player.dir;
+  g_ray_cache->plane = g_camera.plane;
+  g_ray_cache->det = g_player.dir.x * g_camera.plane.y -
+                     g_player.dir.y * g_camera.plane.x;
+}
+
+static inline
+void invalidate_ray_cache(void) {
+  g_ray_caches[0].valid = false;
+  g_ray_caches[1].valid = false;
+}
+
+static inline
+void draw_traced_column(const struct traced_column* c) {
+  g_ray_cache->columns[c->x] = *c;
+  /* Store distance (squared) in z-buffer */
+  zb_set_depth(c->x, c->hit.dist * c->hit.dist);
+  draw_column(c->cell_id, c->x, &c->hit);
+}
+
+/* Two rays end on the same face if they stopped in the same cell, after
+ * crossing a grid line with the same orientation. This holds for rays that
+ * left the map or ran out of steps too: they end on the face they would
+ * have hit next.
+ */
+static inline
+b8 same_face(const struct traced_column* a, const struct traced_column* b) {
+  return a->hit.vertical == b->hit.vertical &&
+         a->hit.cell.x == b->hit.cell.x && a->hit.cell.y == b->hit.cell.y &&
+         /* Rays stopped in the camera cell (or right on its border) did not
+          * hit a face at all.
+          */
+         a->hit.dist > 0.0f && b->hit.dist > 0.0f;
+}
+
+/* Resolve the ray along @ray_dir from the last frame's faces. If it falls
+ * between two of the last frame's rays that ended on the same face, it ends
+ * there too (see render_face_span). Returns false if it does not, or if the
+ * camera has moved.
+ */
+static inline
+b8 lookup_column(const vec2f* ray_dir, struct traced_column* c) {
+  const struct ray_cache* last = g_last_ray_cache;
+  const struct traced_column *a, *b;
+  f32 den, cam_x, col;
+  i32 i;
+
+  if (last == NULL)
+    return false;
+
+  /* Solve t * ray_dir = last->dir + last->plane * cam_x, the ray must point
+   * in front of the last camera (t > 0).
+   */
+  den = ray_dir->x * last->plane.y - ray_dir->y * last->plane.x;
+  if (den * last->det <= 0.0f)
+    return false;
+  cam_x = (ray_dir->y * last->dir.x - ray_dir->x * last->dir.y) / den;
+
+  /* Find the two columns rendered on the last frame around the ray */
+  col = (cam_x + 1.0f) * 0.5f * (f32)last->w - (f32)last->parity;
+  if (!(col >= 0.0f && col < (f32)(last->w - last->step - last->parity)))
+    return false;
+  i = ((i32)col & -(i32)last->step) + last->parity;
+  a = &last->columns[i];
+  b = &last->columns[i + last->step];
+  if (!same_face(a, b))
+    return false;
+
+  /* Compute the distance to the face */
+  c->cell_id = a->cell_id;
+  c->hit = a->hit;
+  if (a->hit.vertical)
+    c->hit.dist = ((f32)(i32)a->hit.cell.x + (ray_dir->x < 0.0f) -
+                   g_camera.pos.x) / ray_dir->x;
+  else
+    c->hit.dist = ((f32)(i32)a->hit.cell.y + (ray_dir->y < 0.0f) -
+                   g_camera.pos.y) / ray_dir->y;
+  return true;
+}
+
+static inline
+void trace_column(i32 x, struct traced_column* c) {
+  f32 cam_x;
+  vec2f ray_dir;
+
+  cam_x = (2.0f * ((f32)x / g_view.w)) - 1.0f;
+  ray_dir.x = g_player.dir.x + g_camera.plane.x * cam_x;
+  ray_dir.y = g_player.dir.y + g_camera.plane.y * cam_x;
+
+  c->x = x;
+  if (!lookup_column(&ray_dir, c))
+    c->cell_id = trace_ray(&g_camera.pos, &ray_dir, g_camera.dof, &c->hit);
+  draw_traced_column(c);
+}
+
+/* Draw the columns between @a and @b, which ended on the same face.
+ * Perpendicular distances to a face are of the form k / ray_dir.x (or
+ * ray_dir.y), and ray directions are linear in x: the inverse of the
+ * distance (and so the wall height) is linear across the face.
+ */
+static
+void fill_face(const struct traced_column* a, const struct traced_column* b) {
+  f32 inv_dist, inv_step;
+  struct traced_column c;
+
+  c = *a;
+  inv_dist = 1.0f / a->hit.dist;
+  inv_step = (1.0f / b->hit.dist - inv_dist) * (f32)g_interlace.step /
+             (f32)(b->x - a->x);
+  while ((c.x += g_interlace.step) < b->x) {
+    inv_dist += inv_step;
+    c.hit.dist = 1.0f / inv_dist;
+    draw_traced_column(&c);
+  }
+}
+
+/* Draw the columns between @a and @b, which have already been drawn.
+ *
+ * If both rays ended on the same face, every ray in between ends there
+ * too: a wall cell in the way would have to fit in the triangle formed by
+ * the two rays and the face, which is less than a cell wide. Otherwise,
+ * trace the middle column and try again on both halves, so that rays are
+ * only traced around face boundaries.
+ */
+static
+void render_face_span(const struct traced_column* a,
+                      const struct traced_column* b) {
+  struct traced_column mid;
+
+  if (b->x - a->x <= (i32)g_interlace.step)
+    return;
 
-    draw_column(cell_id, x, &hit);
+  if (same_face(a, b)) {
+    fill_face(a, b);
+    return;
   }
+
+  trace_column(a->x + (((b->x - a->x) >> 1) & -(i32)g_interlace.step), &mid);
+  render_face_span(a, &mid);
+  render_face_span(&mid, b);
 }
 
 static inline
-void render_sprites(void) {
-  vec2f proj, diff, dir_to_s;
-  u32 i, j, k, n;
-  struct sprite *s, *on_screen_sprites[MAX_SPRITES];
+void render_scene(i32 x_start, i32 x_end) {
+  struct traced_column first, last;
 
-  n = 0;
-  for (i = 0; i < g_sprites.n; ++i) {
-    s = g_sprites.s + i;
+  x_start = first_column(x_start);
+  x_end = last_column(x_end - 1);
+  if (x_start > x_end)
+    return;
 
-    /* Do not render disabled sprites */
-    if (s->disabled)
-      continue;
+  trace_column(x_start, &first);
+  if (x_end > x_start) {
+    trace_column(x_end, &last);
+    render_face_span(&first, &last);
+  }
+}
 
-    /* Do not render the tracked sprite.
-     * FIXME: Find a better way to do this maybe?
+/* Slots of the sprites that survived culling, sorted back to front. The
+ * order carries over to the next frame, where it is only repaired, as
+ * sprites rarely change their depth order much between two frames.
+ */
+static u32 g_n_on_screen_sprites;
+static u16 g_on_screen_sprites[MAX_SLOTS];
+
+/* Transform the slots [@first, @end) to camera space and clear in_view for
+ * the ones that are behind the camera or clearly off screen. There are no
+ * branches and every field is its own array, so that the compiler can do
+ * several sprites at once with SIMD instructions.
+ */
+static
+void transform_sprites(u32 first, u32 end) {
+  const f32 m11 = g_camera.inv_mat.m11, m12 = g_camera.inv_mat.m12;
+  const f32 m21 = g_camera.inv_mat.m21, m22 = g_camera.inv_mat.m22;
+  const f32 half_w = (f32)(g_view.w >> 1), w = (f32)g_view.w;
+  f32 x, y, center, halfw;
+  u32 i;
+
+  for (i = first; i < end; ++i) {
+    x = m11 * g_sprite_proj.cam_x[i] + m12 * g_sprite_proj.cam_y[i];
+    y = m21 * g_sprite_proj.cam_x[i] + m22 * g_sprite_proj.cam_y[i];
+    g_sprite_proj.cam_x[i] = x;
+    g_sprite_proj.cam_y[i] = y;
+    /* The screen bounds test of project_sprite(..), multiplied by the
+     * depth and with two pixels of slack for its rounding.
      */
-    if (s == g_tracked_sprite)
-      continue;
+    center = half_w * (y + x);
+    halfw = g_sprite_proj.halfw[i] + 2.0f * y;
+    g_sprite_proj.in_view[i] &= (y >= 0.0f) & (center + halfw >= 0.0f) &
+                                (center - halfw < w * y);
+  }
+}
+
+/* Finish projecting the sprite in @slot, which transform_sprites(..) left
+ * in view. Returns false if it turns out not to be on screen.
+ */
+static inline
+b8 project_sprite(u32 slot) {
+  const enum sprite_type type = get_slot_type(slot);
+  vec2f proj, diff, dir_to_s;
+  i32 screen_x, screen_halfw;
+  f32 inv_depth;
 
-    diff = VEC2SUB(&s->pos, &g_camera.pos);
+  proj.x = g_sprite_proj.cam_x[slot];
+  proj.y = g_sprite_proj.cam_y[slot];
 
-    /* Compute coordinates in camera space */
-    proj.x = g_camera.inv_mat.m11 * diff.x + g_camera.inv_mat.m12 * diff.y;
-    proj.y = g_camera.inv_mat.m21 * diff.x + g_camera.inv_mat.m22 * diff.y;
+  /* Save camera depth */
+  inv_depth = 1.0f / proj.y;
 
-    /* Sprite is behind the camera, ignore it */
-    if (proj.y < 0.0f)
-      continue;
+  /* Compute screen x */
+  screen_x = (f32)(g_view.w >> 1) * (1.0f + proj.x / proj.y);
+  /* Compute screen width (we divide by two since
+   * we always use the half screen width).
+   */
+  screen_halfw =
+    (i32)((f32)g_sprite_dims[type].x * g_view.scale_x * inv_depth) >> 1;
 
-    /* Save camera depth */
-    s->inv_depth = 1.0f / proj.y;
+  /* Sprite is not on screen, ignore it */
+  if (screen_x + screen_halfw < 0 || screen_x - screen_halfw >= (i32)g_view.w)
+    return false;
 
-    /* Compute screen x */
-    s->screen_x = (f32)(FB_WIDTH >> 1) * (1.0f + proj.x / proj.y);
-    /* Compute screen width (we divide by two since
-     * we always use the half screen width).
+  g_sprite_proj.inv_depth[slot] = inv_depth;
+  g_sprite_proj.screen_x[slot] = screen_x;
+  g_sprite_proj.screen_halfw[slot] = screen_halfw;
+  g_sprite_proj.depth2[slot] = proj.y * proj.y;
+
+  /* Compute angle relative to the player direction vector */
+  if (type == SPRITE_PLAYER) {
+    /* Only do this for player sprites since they're the only sprites
+     * that need it.
      */
-    s->screen_halfw =
-      (i32)((f32)g_sprite_dims[s->desc.type].x * s->inv_depth) >> 1;
+    diff = get_sprite_draw_pos(slot);
+    diff.x -= g_camera.pos.x;
+    diff.y -= g_camera.pos.y;
+    dir_to_s = vec2f_normalized(&diff);
+    g_sprite_proj.rel_rot[slot] =
+      acos(dir_to_s.x * g_player.dir.x + dir_to_s.y * g_player.dir.y) *
+      signf(proj.x) + g_player.rot;
+  }
 
-    /* Sprite is not on screen, ignore it */
-    if (s->screen_x + s->screen_halfw < 0 ||
-        s->screen_x - s->screen_halfw >= (i32)FB_WIDTH)
-      continue;
+  return true;
+}
 
-    s->depth2 = proj.y * proj.y;
+/* Same as project_sprite(..), for all the projectiles in the slots
+ * [@first, @end) at once. Bullets all have the same size and no facing, so
+ * every field is computed for every slot without branches, and in_view is
+ * cleared for the ones that turn out not to be on screen.
+ */
+static
+void project_projectiles(u32 first, u32 end) {
+  const f32 half_w = (f32)(g_view.w >> 1);
+  const f32 width = (f32)g_sprite_dims[SPRITE_BULLET].x * g_view.scale_x;
+  b8* in_view = g_sprite_proj.in_view;
+  i32 screen_x, screen_halfw;
+  f32 x, y, inv_depth;
+  u32 i;
+
+  for (i = first; i < end; ++i) {
+    /* Slots out of view may be behind the camera, give them a harmless
+     * depth instead of branching around them.
+     */
+    x = in_view[i] ? g_sprite_proj.cam_x[i] : 0.0f;
+    y = in_view[i] ? g_sprite_proj.cam_y[i] : 1.0f;
+    inv_depth = 1.0f / y;
+    screen_x = half_w * (1.0f + x / y);
+    screen_halfw = (i32)(width * inv_depth) >> 1;
+
+    g_sprite_proj.inv_depth[i] = inv_depth;
+    g_sprite_proj.screen_x[i] = screen_x;
+    g_sprite_proj.screen_halfw[i] = screen_halfw;
+    g_sprite_proj.depth2[i] = y * y;
+    in_view[i] &= (screen_x + screen_halfw >= 0) &
+                  (screen_x - screen_halfw < (i32)g_view.w);
+  }
+}
 
-    /* Compute angle relative to the player direction vector */
-    if (s->desc.type == SPRITE_PLAYER) {
-      /* Only do this for player sprites since they're the only sprites
-       * that need it.
-       */
-      dir_to_s = vec2f_normalized(&diff);
-      s->rel_rot =
-        acos(dir_to_s.x * g_player.dir.x + dir_to_s.y * g_player.dir.y);
-      s->rel_rot *= signf(proj.x);
-      s->rel_rot += g_player.rot;
+/* Insertion sort moves allowed per sprite before falling back to a radix
+ * sort, i.e. how far out of order sprites can be on average.
+ */
+#define MAX_SORT_SHIFTS 4
+
+/* Sort the slots in @v back to front with an insertion sort, which takes
+ * linear time when @v is almost sorted. Returns false if it gave up after
+ * moving sprites more than @max_shifts times.
+ */
+static
+b8 insertion_sort_sprites(u16* v, u32 n, u32 max_shifts) {
+  const f32* depth2 = g_sprite_proj.depth2;
+  u32 i, j, shifts = 0;
+  u16 slot;
+
+  for (i = 1; i < n; ++i) {
+    slot = v[i];
+    for (j = i; j > 0 && depth2[v[j - 1]] < depth2[slot]; --j)
+      v[j] = v[j - 1];
+    v[j] = slot;
+    if ((shifts += i - j) > max_shifts)
+      return false;
+  }
+
+  return true;
+}
+
+/* Sort the slots in @v back to front by the top 16 bits of the depth
+ * (non-negative floats order like their bit patterns), one byte per pass.
+ * There is an even number of passes, so the result ends up back in @v.
+ */
+static
+void radix_sort_sprites(u16* v, u32 n) {
+  static u16 tmp[MAX_SLOTS];
+  const u32* depth2 = (const u32*)g_sprite_proj.depth2;
+  u16 *src = v, *dst = tmp, *swap;
+  u32 count[0x100];
+  u32 i, shift, key, sum, c;
+
+  for (shift = 16; shift < 32; shift += 8) {
+    memset(count, 0, sizeof(count));
+    for (i = 0; i < n; ++i) {
+      /* Invert the key to sort from the farthest sprite */
+      key = ~(depth2[src[i]] >> shift) & 0xFF;
+      ++count[key];
+    }
+    for (i = 0, sum = 0; i < ARRLEN(count); ++i) {
+      c = count[i];
+      count[i] = sum;
+      sum += c;
     }
+    for (i = 0; i < n; ++i) {
+      key = ~(depth2[src[i]] >> shift) & 0xFF;
+      dst[count[key]++] = src[i];
+    }
+    swap = src;
+    src = dst;
+    dst = swap;
+  }
+}
+
+static inline
+void sort_sprites(u16* v, u32 n) {
+  if (insertion_sort_sprites(v, n, n * MAX_SORT_SHIFTS))
+    return;
+  /* The order changed a lot, sort the truncated depths and then fix up the
+   * sprites that ended up out of order within the same bucket.
+   */
+  radix_sort_sprites(v, n);
+  insertion_sort_sprites(v, n, ~0U);
+}
+
+/* Returns true if @slot holds a sprite or a projectile */
+static inline
+b8 is_slot_used(u32 slot) {
+  return slot < MAX_SPRITES ? slot < g_sprites.n :
+                              slot < PROJECTILE_SLOT(g_projectiles.n);
+}
+
+static inline
+void project_sprites(void) {
+  const u32 projectiles_end = PROJECTILE_SLOT(g_projectiles.n);
+  const f32 bullet_halfw =
+    (f32)g_sprite_dims[SPRITE_BULLET].x * g_view.scale_x * 0.5f;
+  const struct sprite* tracked = game_get_sprite(g_tracked_sprite);
+  b8* in_view = g_sprite_proj.in_view;
+  u32 i, j, n;
+  u16 slot;
+  vec2f pos;
+  struct sprite* s;
+
+  /* Gather what the projection needs into its own arrays */
+  for (i = 0; i < g_sprites.n; ++i) {
+    s = g_sprites.s + i;
+    pos = get_sprite_draw_pos(i);
+    g_sprite_proj.cam_x[i] = pos.x - g_camera.pos.x;
+    g_sprite_proj.cam_y[i] = pos.y - g_camera.pos.y;
+    g_sprite_proj.halfw[i] =
+      (f32)g_sprite_dims[s->desc.type].x * g_view.scale_x * 0.5f;
+    /* Do not render disabled sprites, nor the tracked sprite.
+     * FIXME: Find a better way to do this maybe?
+     */
+    in_view[i] = !s->disabled && s != tracked;
+  }
+  for (i = 0, j = PROJECTILE_SLOT(0); j < projectiles_end; ++i, ++j) {
+    pos = get_projectile_draw_pos(i);
+    g_sprite_proj.cam_x[j] = pos.x - g_camera.pos.x;
+    g_sprite_proj.cam_y[j] = pos.y - g_camera.pos.y;
+    g_sprite_proj.halfw[j] = bullet_halfw;
+    in_view[j] = !g_projectiles.disabled[i];
+  }
+
+  transform_sprites(0, g_sprites.n);
+  transform_sprites(PROJECTILE_SLOT(0), projectiles_end);
 
-    /* Look for index to insert the new sprite */
-    for (j = 0; j < n; ++j) {
-      if (on_screen_sprites[j]->depth2 < s->depth2)
-        break;
+  for (i = 0; i < g_sprites.n; ++i) {
+    if (in_view[i])
+      in_view[i] = project_sprite(i);
+  }
+  project_projectiles(PROJECTILE_SLOT(0), projectiles_end);
+
+  /* Keep the sprites that are still on screen in last frame's order,
+   * clearing in_view once a sprite is listed.
+   */
+  n = 0;
+  for (i = 0; i < g_n_on_screen_sprites; ++i) {
+    slot = g_on_screen_sprites[i];
+    if (is_slot_used(slot) && in_view[slot]) {
+      in_view[slot] = false;
+      g_on_screen_sprites[n++] = slot;
     }
-    /* Move elements after the entry to the next index */
-    for (k = n; k > j; --k)
-      on_screen_sprites[k] = on_screen_sprites[k-1];
-    /* Store the new sprite to render */
-    on_screen_sprites[j] = s;
+  }
+  /* Then add the ones that just came on screen */
+  for (i = 0; i < g_sprites.n; ++i) {
+    if (in_view[i])
+      g_on_screen_sprites[n++] = i;
+  }
+  for (i = PROJECTILE_SLOT(0); i < projectiles_end; ++i) {
+    if (in_view[i])
+      g_on_screen_sprites[n++] = i;
+  }
 
-    if (++n >= MAX_SPRITES)
-      break;
+  sort_sprites(g_on_screen_sprites, n);
+  g_n_on_screen_sprites = n;
+}
+
+#ifdef USE_FRONT_TO_BACK_SPRITES
+
+/* Draw the nearest sprites first, skipping the pixels they already cover,
+ * so that every pixel is written at most once.
+ */
+static inline
+void render_sprites(i32 x_start, i32 x_end) {
+  u32 i;
+  memset(g_sprite_coverage[x_start], 0,
+         (x_end - x_start) * sizeof(g_sprite_coverage[0]));
+  for (i = g_n_on_screen_sprites; i > 0; --i)
+    draw_sprite(g_on_screen_sprites[i - 1], x_start, x_end);
+}
+
+#else
+
+static inline
+void render_sprites(i32 x_start, i32 x_end) {
+  u32 i;
+  for (i = 0; i < g_n_on_screen_sprites; i++)
+    draw_sprite(g_on_screen_sprites[i], x_start, x_end);
+}
+
+#endif
+
+/* First column of the vertical strip @strip out of @n_strips. Strips start
+ * on a depth tile boundary, so that they never share a depth tile.
+ */
+static inline
+i32 get_strip_start(u32 strip, u32 n_strips) {
+  if (strip == n_strips)
+    return g_view.w;
+  return ((g_view.w * strip) / n_strips) & ~(ZB_TILE - 1);
+}
+
+/* Fill the columns in [x_start, x_end) that were not rendered and could not
+ * be reprojected (see reproject_columns) with the rendered column next to
+ * them, which is always in the same strip.
+ */
+static inline
+void fill_stale_columns(i32 x_start, i32 x_end) {
+  i32 x;
+
+  x_start = MAX(x_start, g_interlace.stale_start);
+  x_end = MIN(x_end, g_interlace.stale_end);
+  for (x = x_start + ((x_start ^ g_interlace.parity ^ 1) & 1); x < x_end;
+       x += 2) {
+    if ((u32)(x ^ 1) < g_view.w)
+      copy_column(x, x ^ 1);
   }
+}
+
+/* Render the 3D view in the vertical strip @strip out of @n_strips.
+ * Strips do not share any pixel or z-buffer entry, so they can be rendered
+ * concurrently once the camera has been updated and the sprites projected.
+ */
+static
+void render_strip(u32 strip, u32 n_strips) {
+  i32 x_start, x_end;
+
+  x_start = get_strip_start(strip, n_strips);
+  x_end = get_strip_start(strip + 1, n_strips);
+
+  render_scene(x_start, x_end);
+  zb_build_tiles(first_column(x_start), x_end, g_interlace.step);
+  render_sprites(x_start, x_end);
+  fill_stale_columns(x_start, x_end);
+  /* Copy the strip to the host framebuffer, the HUD is drawn on top of it */
+  cb_present(x_start, x_end);
+}
 
-  for (i = 0; i < n; i++)
-    draw_sprite(on_screen_sprites[i]);
+#ifdef USE_PLATFORM_THREADS
+/* Called by the host from its render workers (see platform_render_strips) */
+void gloom_render_strip(u32 strip, u32 n_strips) {
+  if (strip < n_strips)
+    render_strip(strip, n_strips);
 }
+#endif
 
 static inline
 u32 invert_color(u32 color) {
@@ -645,6 +2004,7 @@ void render_minimap(void) {
   u32 i, j;
   u32 x, y;
   u8 cell_id;
+  vec2f pos;
 
   minimap_x = FB_WIDTH - (g_map.w * MINIMAP_TILE_W) - 4;
   minimap_y = 4;
@@ -666,30 +2026,316 @@ void render_minimap(void) {
     }
   }
 
+  pos = get_player_draw_pos();
   ui_draw_rect(
-            minimap_x + g_player.pos.x * MINIMAP_TILE_W - (MINIMAP_TILE_W >> 2),
-            minimap_y + g_player.pos.y * MINIMAP_TILE_H - (MINIMAP_TILE_H >> 2),
+            minimap_x + pos.x * MINIMAP_TILE_W - (MINIMAP_TILE_W >> 2),
+            minimap_y + pos.y * MINIMAP_TILE_H - (MINIMAP_TILE_H >> 2),
             MINIMAP_TILE_W >> 1, MINIMAP_TILE_H >> 1,
             COLOR(RED));
 }
 
 void game_render(void) {
-  render_scene();
-  render_sprites();
+  b8 redraw;
+
+  redraw = update_view();
+  update_camera();
+  update_interlacing(redraw);
+  project_sprites();
+  update_ray_cache();
+#ifdef USE_PLATFORM_THREADS
+  /* Render the 3D view on the host's workers, this returns only after
+   * every strip has been drawn.
+   */
+  platform_render_strips();
+#else
+  render_strip(0, 1);
+#endif
   render_crosshair();
   render_health_bar();
   render_kill_counter();
   render_minimap();
 }
 
+static inline
+u8 get_map_dist(i32 x, i32 y) {
+  if ((u32)x >= g_map.w || (u32)y >= g_map.h)
+    return 0;
+  return g_map.dist[x + y * g_map.w];
+}
+
+/* Count the cells from each cell to the closest wall along @dir, walking
+ * every row (or column) starting from the edge of the map @dir points to.
+ */
+static
+void build_axis_distances(enum axis_dir dir) {
+  const b8 along_x = dir == AXIS_POS_X || dir == AXIS_NEG_X;
+  const b8 forward = dir == AXIS_POS_X || dir == AXIS_POS_Y;
+  const i32 lines = along_x ? g_map.h : g_map.w;
+  const i32 len = along_x ? g_map.w : g_map.h;
+  const i32 stride = along_x ? 1 : g_map.w;
+  const i32 line_stride = along_x ? g_map.w : 1;
+  i32 line, i, index, step;
+  u8 d, *axis_dist = g_map.axis_dist[dir];
+
+  /* Walk each line against @dir, so that the next cell along @dir has
+   * always been visited already.
+   */
+  step = forward ? -stride : +stride;
+  for (line = 0; line < lines; ++line) {
+    index = line * line_stride + (forward ? (len - 1) * stride : 0);
+    d = MAP_NO_WALL;
+    for (i = 0; i < len; ++i, index += step) {
+      if (g_map.tiles[index])
+        d = 0;
+      else if (d != MAP_NO_WALL)
+        ++d;
+      axis_dist[index] = d;
+    }
+  }
+}
+
+/* Must be called every time g_map.tiles changes, trace_ray(..) uses the
+ * distances to skip over empty space and game_move_and_collide(..) the
+ * axis distances to find the walls around a point.
+ */
+void game_build_map_distances(void) {
+  enum axis_dir dir;
+  i32 x, y;
+  u8 d, *dist;
+
+  /* Two pass distance transform: the first pass propagates the distances
+   * from the walls above and to the left of each cell, the second one from
+   * the walls below and to the right.
+   */
+  for (y = 0; y < (i32)g_map.h; ++y) {
+    for (x = 0; x < (i32)g_map.w; ++x) {
+      dist = &g_map.dist[x + y * g_map.w];
+      if (g_map.tiles[x + y * g_map.w]) {
+        *dist = 0;
+        continue;
+      }
+      d = MIN(get_map_dist(x - 1, y - 1), get_map_dist(x, y - 1));
+      d = MIN(d, get_map_dist(x + 1, y - 1));
+      d = MIN(d, get_map_dist(x - 1, y));
+      *dist = d + 1;
+    }
+  }
+
+  for (y = (i32)g_map.h - 1; y >= 0; --y) {
+    for (x = (i32)g_map.w - 1; x >= 0; --x) {
+      dist = &g_map.dist[x + y * g_map.w];
+      d = MIN(get_map_dist(x + 1, y + 1), get_map_dist(x, y + 1));
+      d = MIN(d, get_map_dist(x - 1, y + 1));
+      d = MIN(d, get_map_dist(x + 1, y));
+      *dist = MIN(*dist, d + 1);
+    }
+  }
+
+  for (dir = 0; dir < AXIS_MAX; ++dir)
+    build_axis_distances(dir);
+
+  /* Faces hit last frame may be gone */
+  invalidate_ray_cache();
+}
+
 void game_init_player(vec2f pos, f32 rot) {
   g_display_health = g_player.health = PLAYER_MAX_HEALTH;
-  g_camera.pos = g_player.pos = pos;
+  g_camera.pos = g_player.pos = g_sim.player_pos = pos;
   g_player.kills = 0;
   game_player_set_rot(rot);
 }
 
+#ifdef USE_PLATFORM_CLOCK
+
+/* Pick the resolution of the 3D view from the time spent in the last
+ * game_tick(..), so that it stays within the frame budget.
+ */
+static inline
+void update_resolution(f32 frame_time) {
+  f32 scale;
+
+  g_resolution.frame_time =
+    lerp(FRAME_TIME_SMOOTHING, frame_time, g_resolution.frame_time);
+
+  /* Give the smoothed frame time a chance to settle after every change */
+  if (g_resolution.cooldown > 0) {
+    --g_resolution.cooldown;
+    return;
+  }
+
+  scale = g_resolution.scale;
+  if (g_resolution.frame_time > g_resolution.budget)
+    scale -= VIEW_SCALE_STEP;
+  else if (g_resolution.frame_time <
+           g_resolution.budget * VIEW_SCALE_HEADROOM)
+    scale += VIEW_SCALE_STEP;
+  scale = MIN(MAX(scale, (f32)CB_MIN_WIDTH / FB_WIDTH), 1.0f);
+
+  if (scale != g_resolution.scale) {
+    g_resolution.scale = scale;
+    g_resolution.cooldown = VIEW_SCALE_COOLDOWN;
+    cb_set_resolution(FB_WIDTH * scale, FB_HEIGHT * scale);
+  }
+}
+
+/* NOTE: @budget_ms is the target game_tick(..) time in milliseconds,
+ *       0 disables dynamic resolution and renders at full resolution.
+ */
+void gloom_set_frame_budget(f32 budget_ms) {
+  g_resolution.budget = budget_ms * 1e-3f;
+  g_resolution.frame_time = 0.0f;
+  g_resolution.cooldown = 0;
+  if (g_resolution.budget <= 0.0f) {
+    g_resolution.scale = 1.0f;
+    cb_set_resolution(FB_WIDTH, FB_HEIGHT);
+  }
+}
+
+#endif // USE_PLATFORM_CLOCK
+
+/* NOTE: Interlacing halves the work spent on the 3D view while the camera
+ *       stands still or turns, at the cost of showing half of the columns
+ *       one frame late. Moving close to walls renders every column.
+ */
+void gloom_set_interlacing(b8 enabled) {
+  g_interlace.enabled = enabled;
+}
+
+/* Save the positions from before a simulation step */
+static inline
+void save_sim_state(void) {
+  u32 i;
+  u8 id;
+
+  ++g_sim.step;
+  g_sim.player_pos = g_player.pos;
+  for (i = 0; i < g_sprites.n; ++i) {
+    id = g_sprites.s[i].desc.id;
+    g_sim.sprite_pos[id] = (vec2f) { g_sprites.x[i], g_sprites.y[i] };
+    g_sim.sprite_gen[id] = g_sprites.gens[id];
+  }
+  for (i = 0; i < g_projectiles.n; ++i) {
+    id = g_projectiles.id[i];
+    g_sim.projectile_pos[id] = (vec2f) { g_projectiles.x[i], g_projectiles.y[i] };
+    g_sim.projectile_step[id] = g_sim.step;
+  }
+}
+
+/* State of the player right after a simulation step. Only what the client
+ * predicts is saved: everything else comes from the server, and rolling it
+ * back would throw away the updates received since.
+ */
+struct snapshot {
+  u32 step;       /* Step the snapshot was taken after, 0 if unused */
+  vec2f joystick; /* Inputs the step was taken with */
+  f32 rot;
+  vec2f player_pos;
+};
+
+/* The snapshot of step i is kept in g_snapshots[i % MAX_SNAPSHOTS] */
+static struct snapshot g_snapshots[MAX_SNAPSHOTS];
+
+static
+void save_snapshot(void) {
+  struct snapshot* snap = &g_snapshots[g_sim.step % MAX_SNAPSHOTS];
+  snap->step = g_sim.step;
+  snap->joystick = g_joystick;
+  snap->rot = g_player.rot;
+  snap->player_pos = g_player.pos;
+}
+
+static
+void run_step(void) {
+  save_sim_state();
+  game_update(SIM_STEP);
+  save_snapshot();
+}
+
+u32 game_get_step(void) {
+  return g_sim.step;
+}
+
+/* Move the player back to where it was right after @step, so that the steps
+ * after it can be replayed with game_resimulate(..) (e.g. from a position
+ * the server corrected). Returns false if @step is not one of the last
+ * MAX_SNAPSHOTS steps.
+ *
+ * NOTE: The direction the player is looking at is not rolled back, it
+ *       follows the mouse and not the simulation.
+ */
+b8 game_rollback(u32 step) {
+  const struct snapshot* snap = &g_snapshots[step % MAX_SNAPSHOTS];
+  if (step == 0 || snap->step != step || step > g_sim.step)
+    return false;
+
+  g_player.pos = snap->player_pos;
+  g_sim.step = step;
+  return true;
+}
+
+/* Move the player forward until @step, with the same inputs every step was
+ * taken with the first time around, and save the new positions. Steps never
+ * taken before use the current inputs.
+ */
+void game_resimulate(u32 step) {
+  const vec2f joystick = g_joystick;
+  const f32 rot = g_player.rot;
+  const struct snapshot* snap;
+
+  while (g_sim.step < step) {
+    snap = &g_snapshots[++g_sim.step % MAX_SNAPSHOTS];
+    if (snap->step == g_sim.step) {
+      g_joystick = snap->joystick;
+      game_player_set_rot(snap->rot);
+    } else {
+      g_joystick = joystick;
+      game_player_set_rot(rot);
+    }
+    g_sim.player_pos = g_player.pos;
+    update_player_position(SIM_STEP);
+    save_snapshot();
+  }
+
+  g_joystick = joystick;
+  game_player_set_rot(rot);
+}
+
+/* Forget every snapshot, e.g. when a new game starts */
+void game_clear_snapshots(void) {
+  u32 i;
+  for (i = 0; i < MAX_SNAPSHOTS; ++i)
+    g_snapshots[i].step = 0;
+}
+
+/* Time the simulation is behind the last game_tick(..), less than a step */
+f32 game_get_sim_lag(void) {
+  return g_sim.lag;
+}
+
 void game_tick(f32 delta) {
-  game_update(delta);
+  u32 steps;
+#ifdef USE_PLATFORM_CLOCK
+  /* Only time the frame when there is a budget to keep it within */
+  const b8 timed = g_resolution.budget > 0.0f;
+  const u32 start = timed ? platform_clock_us() : 0;
+#endif
+
+  g_sim.lag = MIN(g_sim.lag + delta, MAX_SIM_STEPS * SIM_STEP);
+  for (steps = 0; steps < MAX_SIM_STEPS && g_sim.lag >= SIM_STEP; ++steps) {
+    run_step();
+    g_sim.lag -= SIM_STEP;
+  }
+
+  /* Draw the frame as it is at this point in time, somewhere between the
+   * last two steps. Anything else that renders sees the current state.
+   */
+  g_sim.alpha = g_sim.step > 0 ? MIN(g_sim.lag / SIM_STEP, 1.0f) : 1.0f;
   game_render();
+  g_sim.alpha = 1.0f;
+
+#ifdef USE_PLATFORM_CLOCK
+  /* Unsigned subtraction stays correct across a wrap of the clock */
+  if (timed)
+    update_resolution((f32)(platform_clock_us() - start) * 1e-6f);
+#endif
 }
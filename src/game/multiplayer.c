@@ -106,11 +106,6 @@ DEFINE_SPKT(death, {});
 
 DEFINE_SPKT(terminate, {});
 
-struct input_log {
-  f32 ts;
-  vec2f vel;
-};
-
 static u8 g_player_id;
 static u32 g_game_id;
 static u32 g_player_token;
@@ -120,52 +115,6 @@ static f32 g_game_start;
 
 enum multiplayer_state _g_multiplayer_state;
 
-struct {
-#define IRING_SIZE 128
-  struct input_log *tail, *head;
-  struct input_log buffer[IRING_SIZE];
-} g_iring;
-
-static
-void iring_init(void) {
-  g_iring.tail = g_iring.buffer;
-  g_iring.head = g_iring.buffer;
-}
-
-static
-void iring_push_elem(f32 ts, vec2f* vel) {
-  g_iring.head->ts = ts;
-  g_iring.head->vel = *vel;
-  if (++g_iring.head >= g_iring.buffer + IRING_SIZE)
-    g_iring.head = g_iring.buffer;
-  if (g_iring.head == g_iring.tail)
-    ++g_iring.tail;
-}
-
-static
-void iring_set_tail(struct input_log* ilog) {
-  if ((u32)(ilog - g_iring.buffer) < IRING_SIZE)
-    g_iring.tail = ilog;
-}
-
-static
-struct input_log* iring_get_next(void) {
-  struct input_log* ilog;
-  if (g_iring.tail == g_iring.head)
-    return NULL;
-  ilog = g_iring.tail;
-  if (++g_iring.tail >= g_iring.buffer + IRING_SIZE)
-    g_iring.tail = g_iring.buffer;
-  return ilog;
-}
-
-static
-struct input_log* iring_get_after(struct input_log* ilog) {
-  if (++ilog >= g_iring.buffer + IRING_SIZE)
-    ilog = g_iring.buffer;
-  return ilog == g_iring.head ? NULL : ilog;
-}
-
 /* Draw game id in the bottom-right corner */
 void multiplayer_draw_game_id(void) {
   char gids[32];
@@ -203,7 +152,6 @@ void multiplayer_init(u32 gid, u32 token) {
   g_last_tick_ts = get_ts();
   /* Reset game packet sequence */
   g_client_seq = g_server_seq = 0;
-  iring_init();
   multiplayer_set_state(MULTIPLAYER_CONNECTED);
 }
 
@@ -219,11 +167,6 @@ void multiplayer_set_state(enum multiplayer_state state) {
   }
 }
 
-void multiplayer_queue_input(void) {
-  vec2f vel = game_get_player_velocity();
-  iring_push_elem(get_ts(), &vel);
-}
-
 void multiplayer_signal_ready(b8 yes) {
   struct game_pkt_ready pkt;
   init_game_pkt(&pkt, GPKT_READY);
@@ -267,15 +210,27 @@ void pkt_type_error(const char* pkt_type) {
 
 static
 void apply_sprite_transform(struct sprite* s, struct sprite_transform* t) {
+  const u32 slot = s - g_sprites.s;
   s->rot = t->rot;
-  s->pos = t->pos;
-  s->vel = t->vel;
+  g_sprites.x[slot] = t->pos.x;
+  g_sprites.y[slot] = t->pos.y;
+  g_sprites.vel_x[slot] = t->vel.x;
+  g_sprites.vel_y[slot] = t->vel.y;
   s->disabled = false; /* Reset disabled flag */
+  game_grid_update(slot);
 }
 
+/* Allocate a sprite with the requested @id at the end of g_sprites */
 static inline
-struct sprite* alloc_sprite(void) {
-  return (g_sprites.n < MAX_SPRITES) ? &g_sprites.s[g_sprites.n++] : NULL;
+struct sprite* alloc_sprite(u8 id) {
+  struct sprite* s;
+  if (g_sprites.n >= MAX_SPRITES)
+    return NULL;
+  s = &g_sprites.s[g_sprites.n++];
+  s->desc.id = id;
+  g_sprites.slots[id] = g_sprites.n;
+  ++g_sprites.gens[id];
+  return s;
 }
 
 static
@@ -292,42 +247,124 @@ u32 count_player_sprites(void) {
  */
 static
 struct sprite* get_sprite(u8 id, b8 can_alloc) {
-  struct sprite* s;
-  u32 i = 0;
-  for (i = 0; i < g_sprites.n; ++i) {
-    s = &g_sprites.s[i];
-    if (s->desc.id == id)
-      return s;
-  }
-  if (can_alloc && (s = alloc_sprite()))
-    return s;
-  return NULL;
+  const u32 slot = g_sprites.slots[id];
+  if (slot)
+    return &g_sprites.s[slot - 1];
+  return can_alloc ? alloc_sprite(id) : NULL;
 }
 
 static inline
 void track_sprite(u8 id) {
-  g_tracked_sprite = get_sprite(id, false);
+  struct sprite* s = get_sprite(id, false);
+  g_tracked_sprite =
+    s != NULL ? game_get_sprite_handle(s) : (struct sprite_handle) {0};
 }
 
-/* Remove sprite with the requested @id */
+/* Remove sprite with the requested @id. Sprites are not kept in any
+ * particular order, so the last one simply takes its place. Handles to the
+ * moved sprite stay valid, as they refer to it by id.
+ */
 static
 void destroy_sprite(u8 id) {
-  u32 i, tid;
+  u32 slot;
   struct sprite *s = get_sprite(id, false);
   if (s == NULL)
     return;
 
   printf("destroying sprite %u (type %u)\n", s->desc.id, s->desc.type);
 
-  /* Save the id of the tracked if we're going to shift it */
-  tid = g_tracked_sprite != NULL && g_tracked_sprite->desc.id > s->desc.id ?
-        g_tracked_sprite->desc.id : 0;
-  for (i = (u32)(s - g_sprites.s) + 1; i < g_sprites.n; ++i)
-    g_sprites.s[i - 1] = g_sprites.s[i];
-  --g_sprites.n;
-  /* Update sprite tracker pointer if the position in the array changed */
-  if (tid > 0)
-    track_sprite(tid);
+  game_grid_remove(id);
+  slot = s - g_sprites.s;
+  g_sprites.slots[id] = 0;
+  ++g_sprites.gens[id];
+  if (slot != --g_sprites.n) {
+    *s = g_sprites.s[g_sprites.n];
+    g_sprites.x[slot] = g_sprites.x[g_sprites.n];
+    g_sprites.y[slot] = g_sprites.y[g_sprites.n];
+    g_sprites.vel_x[slot] = g_sprites.vel_x[g_sprites.n];
+    g_sprites.vel_y[slot] = g_sprites.vel_y[g_sprites.n];
+    g_sprites.slots[s->desc.id] = slot + 1;
+  }
+}
+
+/* Remove every sprite and projectile */
+static
+void clear_sprites(void) {
+  u32 i;
+  for (i = 0; i < g_sprites.n; ++i) {
+    game_grid_remove(g_sprites.s[i].desc.id);
+    g_sprites.slots[g_sprites.s[i].desc.id] = 0;
+    ++g_sprites.gens[g_sprites.s[i].desc.id];
+  }
+  g_sprites.n = 0;
+  for (i = 0; i < g_projectiles.n; ++i)
+    g_projectiles.slots[g_projectiles.id[i]] = 0;
+  g_projectiles.n = 0;
+}
+
+static
+void apply_projectile_transform(u32 i, struct sprite_transform* t) {
+  g_projectiles.x[i] = t->pos.x;
+  g_projectiles.y[i] = t->pos.y;
+  g_projectiles.vel_x[i] = t->vel.x;
+  g_projectiles.vel_y[i] = t->vel.y;
+  g_projectiles.disabled[i] = false; /* Reset disabled flag */
+}
+
+/* Get the index of the projectile with the requested @id, or -1 if there is
+ * none. If no projectile with that id exists and @can_alloc is true,
+ * a new projectile with that id will be allocated.
+ */
+static
+i32 get_projectile(u8 id, b8 can_alloc) {
+  if (g_projectiles.slots[id])
+    return g_projectiles.slots[id] - 1;
+  if (can_alloc && g_projectiles.n < MAX_PROJECTILES) {
+    g_projectiles.id[g_projectiles.n] = id;
+    g_projectiles.slots[id] = g_projectiles.n + 1;
+    return g_projectiles.n++;
+  }
+  return -1;
+}
+
+/* Remove projectile with the requested @id. Projectiles are not kept in any
+ * particular order, so the last one simply takes its place.
+ */
+static
+void destroy_projectile(u8 id) {
+  i32 i;
+  u32 last;
+  if ((i = get_projectile(id, false)) < 0)
+    return;
+
+  g_projectiles.slots[id] = 0;
+  if ((u32)i == (last = --g_projectiles.n))
+    return;
+  g_projectiles.slots[g_projectiles.id[last]] = i + 1;
+  g_projectiles.x[i] = g_projectiles.x[last];
+  g_projectiles.y[i] = g_projectiles.y[last];
+  g_projectiles.vel_x[i] = g_projectiles.vel_x[last];
+  g_projectiles.vel_y[i] = g_projectiles.vel_y[last];
+  g_projectiles.id[i] = g_projectiles.id[last];
+  g_projectiles.owner[i] = g_projectiles.owner[last];
+  g_projectiles.disabled[i] = g_projectiles.disabled[last];
+}
+
+/* Initialize projectile from packet data */
+static
+void init_projectile(struct sprite_init* init) {
+  struct sprite* s;
+  i32 i;
+  /* Get or allocate the requested projectile */
+  if ((i = get_projectile(init->desc.id, true)) < 0)
+    return;
+  g_projectiles.owner[i] = init->desc.owner;
+  apply_projectile_transform(i, &init->transform);
+  /* Play the firing animation of the player that fired it.
+   * FIXME: maybe this shouldn't be done in this function?
+   */
+  if ((s = get_sprite(init->desc.owner, false)))
+    s->anim_frame = 6.0f;
 }
 
 /* Initialize sprite from packet data */
@@ -337,6 +374,11 @@ void init_sprite(struct sprite_init* init) {
   /* Check if the sprite type is valid */
   if (init->desc.type >= SPRITE_MAX)
     return;
+  /* Bullets go to the projectile pool */
+  if (init->desc.type == SPRITE_BULLET) {
+    init_projectile(init);
+    return;
+  }
   /* Get or allocate the requested sprite */
   if ((s = get_sprite(init->desc.id, true))) {
     printf("creating sprite with id %u (type %u)\n",
@@ -345,12 +387,6 @@ void init_sprite(struct sprite_init* init) {
     memset(s, 0, sizeof(*s));
     s->desc = init->desc;
     apply_sprite_transform(s, &init->transform);
-    /* If a bullet was fired, play the correct animation for that sprite.
-     * FIXME: maybe this shouldn't be done in this function?
-     */
-    if (s->desc.type == SPRITE_BULLET &&
-        (s = get_sprite(init->desc.owner, false)))
-      s->anim_frame = 6.0f;
   }
 }
 
@@ -395,7 +431,8 @@ void serv_hello_handler(void* buf, u32 len) {
   len -= sizeof(*pkt);
 
   /* Initialize sprites array and map struct */
-  g_sprites.n = 0;
+  clear_sprites();
+  game_clear_snapshots();
   g_map.w = pkt->map_w;
   g_map.h = pkt->map_h;
 
@@ -434,47 +471,34 @@ void serv_hello_handler(void* buf, u32 len) {
       }
     }
   }
+  /* Map changed, rebuild the distance field used to trace rays */
+  game_build_map_distances();
 
   multiplayer_set_state(MULTIPLAYER_WAITING);
 }
 
 static inline
-void reconcile(f32 ts, vec2f* pos, vec2f* vel) {
-  f32 delta;
-  struct input_log* ilog;
-  vec2f diff;
-  const f32 radius = g_sprite_radius[SPRITE_PLAYER];
-
-  /* Discard all old logs */
-  for (ilog = iring_get_next(); ilog != NULL; ilog = iring_get_next()) {
-    if (ts < ilog->ts)
-      break;
-  }
-
-  /* Step through all past events and recompute the current player position */
-  if (ilog != NULL) {
-    iring_set_tail(ilog);
-
-    for (; ilog != NULL; ilog = iring_get_after(ilog)) {
-      delta = ilog->ts - ts;
-      diff = VEC2SCALE(vel, delta);
-      game_move_and_collide(pos, &diff, radius);
-      vel = &ilog->vel;
-      ts = ilog->ts;
-    }
-  }
-
-  delta = g_last_tick_ts - ts;
-  diff = VEC2SCALE(vel, delta);
-  game_move_and_collide(pos, &diff, radius);
-
-  /* Move the player to the recomputed position */
+void reconcile(f32 ts, vec2f* pos) {
+  const u32 step = game_get_step();
+  /* The simulation only got as far as the last fixed step before the last
+   * tick, count the whole steps it ran since the update.
+   */
+  const f32 back = (g_last_tick_ts - game_get_sim_lag() - ts) / SIM_STEP;
+  const u32 steps = back > 0.0f ? (u32)(back + 0.5f) : 0;
+  /* Put the player where the server had it at that step, then replay the
+   * inputs of the steps after it. Updates older than the snapshots kept
+   * just move the player.
+   */
+  const b8 replay = steps > 0 && steps < step && game_rollback(step - steps);
   g_player.pos = *pos;
+  if (replay)
+    game_resimulate(step);
 }
 
 static
 void serv_update_handler(void* buf, u32 len) {
   struct sprite* s;
+  i32 i;
   struct sprite_transform* t;
   struct serv_pkt_update* pkt = buf;
 
@@ -494,9 +518,11 @@ void serv_update_handler(void* buf, u32 len) {
   t = &pkt->transform;
   if (pkt->id == g_player_id)
     /* Update data refers to the player */
-    reconcile(pkt->ts, &t->pos, &t->vel);
+    reconcile(pkt->ts, &t->pos);
   else if ((s = get_sprite(pkt->id, false)))
     apply_sprite_transform(s, t);
+  else if ((i = get_projectile(pkt->id, false)) >= 0)
+    apply_projectile_transform(i, t);
 }
 
 static
@@ -547,12 +573,15 @@ void serv_destroy_handler(void* buf, u32 len) {
      */
     g_player_id = 0;
     return;
-  } else if (g_tracked_sprite != NULL &&
-             pkt->desc.id == g_tracked_sprite->desc.id)
+  } else if (game_get_sprite(g_tracked_sprite) != NULL &&
+             pkt->desc.id == g_tracked_sprite.id)
     /* If the tracked sprite is "killed", follow the "killer" */
     track_sprite(pkt->desc.field);
 
-  destroy_sprite(pkt->desc.id);
+  if (pkt->desc.type == SPRITE_BULLET)
+    destroy_projectile(pkt->desc.id);
+  else
+    destroy_sprite(pkt->desc.id);
 
   switch (pkt->desc.type) {
     case SPRITE_BULLET:
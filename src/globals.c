@@ -4,7 +4,8 @@
 struct player g_player;
 struct map g_map;
 struct sprites g_sprites;
+struct projectiles g_projectiles;
 struct camera g_camera;
 
-struct sprite* g_tracked_sprite;
+struct sprite_handle g_tracked_sprite;
 f32 g_mouse_sensitivity;
@@ -34,7 +34,6 @@ void on_analog_change(f32 x, f32 y) {
     return;
 
   if (game_analog_set(x, y)) {
-    multiplayer_queue_input();
     g_do_send_update = true;
   }
 }
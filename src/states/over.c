@@ -44,9 +44,12 @@ void title(void) {
 
 static
 void on_tick(f32 delta) {
-  if (g_dead && g_tracked_sprite != NULL) {
-    g_player.pos = g_tracked_sprite->pos;
-    game_player_set_rot(g_tracked_sprite->rot);
+  struct sprite* tracked = game_get_sprite(g_tracked_sprite);
+  u32 slot;
+  if (g_dead && tracked != NULL) {
+    slot = tracked - g_sprites.s;
+    g_player.pos = (vec2f) { g_sprites.x[slot], g_sprites.y[slot] };
+    game_player_set_rot(tracked->rot);
   }
   game_tick(delta);
 
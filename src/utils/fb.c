@@ -2,13 +2,97 @@
 #include <gloom/gloom.h>
 
 struct fb _g_fb;
+struct cb _g_cb;
 f32 _g_zbuf[FB_WIDTH];
+struct zb_tile _g_zbuf_tiles[ZB_TILES];
+u32 _g_cbuf[FB_WIDTH * FB_HEIGHT];
+
+/* Side of the square tiles used to transpose the column buffer. 16 pixels
+ * fill a 64 byte cache line on both the read and the write side.
+ */
+#define CB_TILE 16
+
+/* Offset in _g_cbuf of the column shown at each framebuffer column, and
+ * row of the column buffer shown at each framebuffer row.
+ */
+static u32 g_cb_xoff[FB_WIDTH];
+static u32 g_cb_ymap[FB_HEIGHT];
+
+void cb_set_resolution(u32 w, u32 h) {
+  u32 x, y;
+
+  w = MIN(MAX(w, CB_MIN_WIDTH), FB_WIDTH);
+  h = MIN(MAX(h, CB_MIN_HEIGHT), FB_HEIGHT);
+
+  _g_cb.w = w;
+  _g_cb.h = h;
+
+  /* Nearest neighbour upscaling */
+  for (x = 0; x < FB_WIDTH; ++x)
+    g_cb_xoff[x] = ((x * w) / FB_WIDTH) * FB_HEIGHT;
+  for (y = 0; y < FB_HEIGHT; ++y)
+    g_cb_ymap[y] = (y * h) / FB_HEIGHT;
+}
+
+/* Copy the columns [@x_start, @x_end) of the column buffer to the host
+ * framebuffer, upscaling them if the internal resolution is lower than the
+ * framebuffer resolution. The copy is a transpose, so it is done one
+ * CB_TILE x CB_TILE block of the framebuffer at a time.
+ */
+void cb_present(u32 x_start, u32 x_end) {
+  u32 tx, ty, tx_end, ty_end, x, y;
+  u32 *dst;
+  const u32 *src;
+
+  /* Framebuffer columns that show the requested columns */
+  x_start = (x_start * FB_WIDTH + _g_cb.w - 1) / _g_cb.w;
+  x_end = (x_end * FB_WIDTH + _g_cb.w - 1) / _g_cb.w;
+
+  for (tx = x_start; tx < x_end; tx = tx_end) {
+    tx_end = MIN(tx + CB_TILE, x_end);
+    for (ty = 0; ty < FB_HEIGHT; ty = ty_end) {
+      ty_end = MIN(ty + CB_TILE, FB_HEIGHT);
+      for (y = ty; y < ty_end; ++y) {
+        dst = &_g_fb.pxls[_fb_offset(0, y)];
+        src = &_g_cbuf[g_cb_ymap[y]];
+        for (x = tx; x < tx_end; ++x)
+          dst[x] = src[g_cb_xoff[x]];
+      }
+    }
+  }
+}
+
+/* Summarize the z-buffer columns @x_start, @x_start + @step, ... before
+ * @x_end in the depth tiles that hold them. Only the visited columns
+ * contribute to a tile, as the others may still hold an older frame.
+ * NOTE: Concurrently rendered strips must not share a tile.
+ */
+void zb_build_tiles(u32 x_start, u32 x_end, u32 step) {
+  u32 x, tile_end;
+  f32 depth;
+  struct zb_tile* tile;
+
+  x = x_start;
+  while (x < x_end) {
+    tile = &_g_zbuf_tiles[x / ZB_TILE];
+    tile_end = MIN((x / ZB_TILE + 1) * ZB_TILE, x_end);
+    tile->min = tile->max = _g_zbuf[x];
+    for (x += step; x < tile_end; x += step) {
+      depth = _g_zbuf[x];
+      tile->min = MIN(tile->min, depth);
+      tile->max = MAX(tile->max, depth);
+    }
+  }
+}
 
 void gloom_framebuffer_set(void* fb, u32 stride) {
   _g_fb = (struct fb) {
     .pxls = fb,
     .stride = stride
   };
+  /* Render the 3D view at full resolution until told otherwise */
+  if (_g_cb.w == 0)
+    cb_set_resolution(FB_WIDTH, FB_HEIGHT);
 }
 
 u32 gloom_framebuffer_width(void) {